@@ -0,0 +1,66 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "core/dispatch/include/dispatch.hpp"
+
+namespace {
+
+template <ppc::core::Isa MaxIsa>
+ppc::core::Isa run_kernel(const char* name) {
+  return ppc::core::dispatch<MaxIsa>(name, [](auto isa) { return decltype(isa)::value; });
+}
+
+}  // namespace
+
+TEST(dispatch_tests, check_best_isa) {
+  ppc::core::CpuFeatures features;
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::SCALAR);
+  features.sse2 = true;
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::SSE2);
+  features.avx = features.avx2 = true;
+  // AVX2 variants use FMA as well
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::SSE2);
+  features.fma = true;
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::AVX2);
+  features.avx512f = features.avx512bw = true;
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::AVX2);
+  features.avx512vl = true;
+  EXPECT_EQ(ppc::core::best_isa(features), ppc::core::Isa::AVX512);
+}
+
+TEST(dispatch_tests, check_cpu_features) {
+  auto features = ppc::core::detect_cpu_features();
+  auto isa = ppc::core::cpu_isa();
+  EXPECT_EQ(isa, ppc::core::best_isa(features));
+  EXPECT_LE(ppc::core::active_isa(), isa);
+#if PPC_DISPATCH_X86
+  EXPECT_TRUE(features.sse2);
+  if (features.avx2) {
+    EXPECT_TRUE(features.avx);
+  }
+#endif
+}
+
+TEST(dispatch_tests, check_isa_names) {
+  for (auto isa : {ppc::core::Isa::SCALAR, ppc::core::Isa::SSE2, ppc::core::Isa::AVX2, ppc::core::Isa::AVX512}) {
+    EXPECT_EQ(ppc::core::parse_isa(ppc::core::isa_name(isa)), isa);
+  }
+  EXPECT_FALSE(ppc::core::parse_isa("avx1024").has_value());
+}
+
+TEST(dispatch_tests, check_dispatch_records_variant) {
+  auto isa = run_kernel<ppc::core::Isa::AVX512>("dispatch_tests_kernel");
+#if PPC_DISPATCH_X86
+  EXPECT_EQ(isa, ppc::core::active_isa());
+#else
+  EXPECT_EQ(isa, ppc::core::Isa::SCALAR);
+#endif
+  auto scalar = run_kernel<ppc::core::Isa::SCALAR>("dispatch_tests_scalar_kernel");
+  EXPECT_EQ(scalar, ppc::core::Isa::SCALAR);
+
+  auto variants = ppc::core::used_variants();
+  EXPECT_EQ(variants["dispatch_tests_kernel"], ppc::core::isa_name(isa));
+  EXPECT_EQ(variants["dispatch_tests_scalar_kernel"], "scalar");
+}
@@ -0,0 +1,89 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DISPATCH_HPP_
+#define MODULES_CORE_INCLUDE_DISPATCH_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+// Variants of kernels for wider registers are compiled with target
+// attributes of GCC and Clang on x86-64, so a binary built without -march
+// runs on every CPU. Other compilers and architectures get scalar variants.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define PPC_DISPATCH_X86 1
+#define PPC_TARGET_AVX2 [[gnu::target("avx2,fma")]]
+#define PPC_TARGET_AVX512 [[gnu::target("avx512f,avx512bw,avx512vl")]]
+#else
+#define PPC_DISPATCH_X86 0
+#endif
+
+namespace ppc::core {
+
+// Instruction sets of kernel variants, SSE2 is the baseline of x86-64
+enum class Isa : uint8_t { SCALAR, SSE2, AVX2, AVX512 };
+
+struct CpuFeatures {
+  bool sse2 = false;
+  bool avx = false;
+  bool avx2 = false;
+  bool fma = false;
+  bool avx512f = false;
+  bool avx512bw = false;
+  bool avx512vl = false;
+};
+
+// Features from cpuid, wide registers count only when the OS saves them
+CpuFeatures detect_cpu_features();
+// The widest variant which can run with features
+Isa best_isa(const CpuFeatures& features);
+// best_isa() of this CPU, detected once
+Isa cpu_isa();
+// cpu_isa() lowered by PPC_ISA (scalar, sse2, avx2, avx512), SCALAR when
+// variants for wider registers aren't compiled (PPC_DISPATCH_X86 is 0)
+Isa active_isa();
+
+const char* isa_name(Isa isa);
+std::optional<Isa> parse_isa(const std::string& name);
+
+// Variants which ran, by names of kernels. Every call site of dispatch()
+// records its variant once.
+void record_variant(const std::string& kernel, Isa isa);
+std::map<std::string, std::string> used_variants();
+
+template <Isa I>
+using IsaTag = std::integral_constant<Isa, I>;
+
+// Call kernel(IsaTag<I>{}) with I = min(active_isa(), MaxIsa), name of the
+// kernel is used for reports. The variant is chosen at the first call.
+template <Isa MaxIsa = Isa::AVX512, class F>
+auto dispatch(const char* kernel_name, F&& kernel) {
+  static const Isa isa = [kernel_name] {
+    auto res = std::min(active_isa(), MaxIsa);
+    record_variant(kernel_name, res);
+    return res;
+  }();
+#if PPC_DISPATCH_X86
+  switch (isa) {
+    case Isa::AVX512:
+      if constexpr (MaxIsa >= Isa::AVX512) return kernel(IsaTag<Isa::AVX512>{});
+      break;
+    case Isa::AVX2:
+      if constexpr (MaxIsa >= Isa::AVX2) return kernel(IsaTag<Isa::AVX2>{});
+      break;
+    case Isa::SSE2:
+      if constexpr (MaxIsa >= Isa::SSE2) return kernel(IsaTag<Isa::SSE2>{});
+      break;
+    default:
+      break;
+  }
+#endif
+  return kernel(IsaTag<Isa::SCALAR>{});
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_DISPATCH_HPP_
@@ -0,0 +1,134 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/dispatch/include/dispatch.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#elif defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace {
+
+#if defined(__x86_64__) || defined(_M_X64)
+struct CpuidRegs {
+  uint32_t eax = 0;
+  uint32_t ebx = 0;
+  uint32_t ecx = 0;
+  uint32_t edx = 0;
+};
+
+CpuidRegs cpuid(uint32_t leaf, uint32_t subleaf) {
+  CpuidRegs regs;
+#if defined(_M_X64) && !defined(__clang__)
+  int values[4];
+  __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+  regs = {static_cast<uint32_t>(values[0]), static_cast<uint32_t>(values[1]), static_cast<uint32_t>(values[2]),
+          static_cast<uint32_t>(values[3])};
+#else
+  __cpuid_count(leaf, subleaf, regs.eax, regs.ebx, regs.ecx, regs.edx);
+#endif
+  return regs;
+}
+
+// Register states enabled by the OS in XCR0
+uint64_t xgetbv() {
+#if defined(_M_X64) && !defined(__clang__)
+  return _xgetbv(0);
+#else
+  uint32_t eax = 0;
+  uint32_t edx = 0;
+  __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool bit(uint32_t value, int index) { return ((value >> index) & 1) != 0; }
+#endif
+
+std::mutex variants_mutex;
+std::map<std::string, std::string> variants;
+
+}  // namespace
+
+ppc::core::CpuFeatures ppc::core::detect_cpu_features() {
+  CpuFeatures features;
+#if defined(__x86_64__) || defined(_M_X64)
+  auto max_leaf = cpuid(0, 0).eax;
+  auto leaf1 = cpuid(1, 0);
+  features.sse2 = bit(leaf1.edx, 26);
+  if (!bit(leaf1.ecx, 27)) return features;  // no OSXSAVE, so no xgetbv
+
+  auto xcr0 = xgetbv();
+  bool os_ymm = (xcr0 & 0x6) == 0x6;
+  bool os_zmm = os_ymm && (xcr0 & 0xE0) == 0xE0;
+  features.avx = os_ymm && bit(leaf1.ecx, 28);
+  features.fma = features.avx && bit(leaf1.ecx, 12);
+  if (max_leaf < 7) return features;
+
+  auto leaf7 = cpuid(7, 0);
+  features.avx2 = features.avx && bit(leaf7.ebx, 5);
+  features.avx512f = os_zmm && bit(leaf7.ebx, 16);
+  features.avx512bw = os_zmm && bit(leaf7.ebx, 30);
+  features.avx512vl = os_zmm && bit(leaf7.ebx, 31);
+#endif
+  return features;
+}
+
+ppc::core::Isa ppc::core::best_isa(const CpuFeatures& features) {
+  if (features.avx512f && features.avx512bw && features.avx512vl) return Isa::AVX512;
+  if (features.avx2 && features.fma) return Isa::AVX2;
+  if (features.sse2) return Isa::SSE2;
+  return Isa::SCALAR;
+}
+
+ppc::core::Isa ppc::core::cpu_isa() {
+  static const Isa isa = best_isa(detect_cpu_features());
+  return isa;
+}
+
+ppc::core::Isa ppc::core::active_isa() {
+#if PPC_DISPATCH_X86
+  auto isa = cpu_isa();
+  if (const char* value = std::getenv("PPC_ISA")) {
+    if (auto limit = parse_isa(value)) isa = std::min(isa, *limit);
+  }
+  return isa;
+#else
+  // variants for wider registers aren't compiled, dispatch() runs scalar ones
+  return Isa::SCALAR;
+#endif
+}
+
+const char* ppc::core::isa_name(Isa isa) {
+  switch (isa) {
+    case Isa::SSE2:
+      return "sse2";
+    case Isa::AVX2:
+      return "avx2";
+    case Isa::AVX512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+std::optional<ppc::core::Isa> ppc::core::parse_isa(const std::string& name) {
+  for (auto isa : {Isa::SCALAR, Isa::SSE2, Isa::AVX2, Isa::AVX512}) {
+    if (name == isa_name(isa)) return isa;
+  }
+  return std::nullopt;
+}
+
+void ppc::core::record_variant(const std::string& kernel, Isa isa) {
+  std::lock_guard<std::mutex> lock(variants_mutex);
+  variants[kernel] = isa_name(isa);
+}
+
+std::map<std::string, std::string> ppc::core::used_variants() {
+  std::lock_guard<std::mutex> lock(variants_mutex);
+  return variants;
+}
@@ -0,0 +1,75 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "core/executor/include/executor.hpp"
+#include "core/task/func_tests/test_task.hpp"
+
+namespace {
+
+std::shared_ptr<ppc::core::TaskData> make_task_data(std::vector<int32_t>& in, std::vector<int32_t>& out) {
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  return taskData;
+}
+
+class ThrowingTask : public ppc::test::TestTask<int32_t> {
+ public:
+  explicit ThrowingTask(std::shared_ptr<ppc::core::TaskData> taskData_) : TestTask(std::move(taskData_)) {}
+  bool run() override { throw std::runtime_error("error in run"); }
+};
+
+}  // namespace
+
+TEST(executor_tests, check_submit) {
+  // Create data of batches
+  const size_t num_batches = 16;
+  std::vector<std::vector<int32_t>> in(num_batches);
+  std::vector<std::vector<int32_t>> out(num_batches, std::vector<int32_t>(1, 0));
+  std::vector<std::shared_ptr<ppc::core::Task>> tasks;
+  for (size_t i = 0; i < num_batches; i++) {
+    in[i] = std::vector<int32_t>(100 + i, 1);
+    tasks.push_back(std::make_shared<ppc::test::TestTask<int32_t>>(make_task_data(in[i], out[i])));
+  }
+
+  ppc::core::TaskExecutor executor(4);
+  std::vector<std::future<bool>> futures;
+  for (const auto& task : tasks) {
+    futures.push_back(executor.submit(task));
+  }
+  for (size_t i = 0; i < num_batches; i++) {
+    EXPECT_TRUE(futures[i].get());
+    EXPECT_EQ(static_cast<size_t>(out[i][0]), in[i].size());
+  }
+}
+
+TEST(executor_tests, check_run_all_on_shared_pool) {
+  std::vector<int32_t> in(50, 2);
+  std::vector<int32_t> out(1, 0);
+  std::vector<int32_t> wrong_out(2, 0);
+
+  ppc::core::ThreadPool pool(2);
+  ppc::core::TaskExecutor executor(pool);
+  EXPECT_EQ(&executor.get_pool(), &pool);
+  EXPECT_TRUE(executor.run_all({std::make_shared<ppc::test::TestTask<int32_t>>(make_task_data(in, out))}));
+  EXPECT_EQ(out[0], 100);
+
+  // validation fails for two elements of output
+  EXPECT_FALSE(executor.run_all({std::make_shared<ppc::test::TestTask<int32_t>>(make_task_data(in, wrong_out))}));
+}
+
+TEST(executor_tests, check_exception) {
+  std::vector<int32_t> in(10, 1);
+  std::vector<int32_t> out(1, 0);
+
+  ppc::core::TaskExecutor executor(1);
+  auto future = executor.submit(std::make_shared<ThrowingTask>(make_task_data(in, out)));
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
@@ -0,0 +1,46 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_EXECUTOR_HPP_
+#define MODULES_CORE_INCLUDE_EXECUTOR_HPP_
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Asynchronous execution of task pipelines on a thread pool. The pipeline of
+// one task (validation -> pre_processing -> run -> post_processing) is run by
+// one job, pipelines of different tasks overlap: e.g. pre_processing of the
+// next batch runs while the previous batch is in run(). A task must not be
+// submitted again before its future is ready. MPI tasks are not supported.
+class TaskExecutor {
+ public:
+  // Executor with its own pool, num_threads == 0 - default count of threads
+  explicit TaskExecutor(size_t num_threads = 0);
+  // Executor on a shared pool, the pool must outlive the executor
+  explicit TaskExecutor(ThreadPool& pool_);
+
+  // Result is false when any function of the task returns false, exceptions
+  // of the task are rethrown by the future
+  std::future<bool> submit(std::shared_ptr<Task> task);
+  // Submit all tasks and wait for them, true if all pipelines succeed
+  bool run_all(const std::vector<std::shared_ptr<Task>>& tasks);
+
+  // Run the whole pipeline in the calling thread
+  static bool run_pipeline(Task& task);
+
+  [[nodiscard]] ThreadPool& get_pool() const { return *pool; }
+
+ private:
+  std::unique_ptr<ThreadPool> own_pool;
+  ThreadPool* pool;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_EXECUTOR_HPP_
@@ -0,0 +1,31 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/executor/include/executor.hpp"
+
+#include <utility>
+
+ppc::core::TaskExecutor::TaskExecutor(size_t num_threads)
+    : own_pool(std::make_unique<ThreadPool>(num_threads)), pool(own_pool.get()) {}
+
+ppc::core::TaskExecutor::TaskExecutor(ThreadPool& pool_) : pool(&pool_) {}
+
+std::future<bool> ppc::core::TaskExecutor::submit(std::shared_ptr<Task> task) {
+  return pool->submit([task = std::move(task)] { return run_pipeline(*task); });
+}
+
+bool ppc::core::TaskExecutor::run_all(const std::vector<std::shared_ptr<Task>>& tasks) {
+  std::vector<std::future<bool>> futures;
+  futures.reserve(tasks.size());
+  for (const auto& task : tasks) {
+    futures.push_back(submit(task));
+  }
+  bool res = true;
+  for (auto& future : futures) {
+    pool->wait(future);
+    res = future.get() && res;
+  }
+  return res;
+}
+
+bool ppc::core::TaskExecutor::run_pipeline(Task& task) {
+  return task.validation() && task.pre_processing() && task.run() && task.post_processing();
+}
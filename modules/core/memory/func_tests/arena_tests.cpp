@@ -0,0 +1,52 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+
+#include "core/memory/include/arena.hpp"
+
+TEST(arena_tests, check_alignment_and_zeroing) {
+  ppc::core::Arena arena;
+  auto bytes = arena.make<char>(3);
+  auto values = arena.make<double>(10);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % alignof(double), 0u);
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0.0), 0.0);
+  auto* aligned = arena.allocate(100, 256);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0u);
+  EXPECT_TRUE(arena.make<int>(0).empty());
+  bytes[2] = 'x';
+  EXPECT_EQ(bytes[2], 'x');
+  EXPECT_GE(arena.used(), 3 + 10 * sizeof(double) + 100);
+}
+
+TEST(arena_tests, check_blocks_are_merged_by_reset) {
+  ppc::core::Arena arena;
+  for (int i = 0; i < 10; i++) {
+    arena.make<int64_t>(50000);
+  }
+  EXPECT_GT(arena.num_blocks(), 1u);
+  auto used = arena.used();
+  arena.reset();
+  EXPECT_EQ(arena.num_blocks(), 1u);
+  EXPECT_EQ(arena.used(), 0u);
+  EXPECT_GE(arena.capacity(), used);
+
+  // the same iteration fits in the merged block
+  auto* first = arena.make<int64_t>(50000).data();
+  for (int i = 1; i < 10; i++) {
+    arena.make<int64_t>(50000);
+  }
+  EXPECT_EQ(arena.num_blocks(), 1u);
+  arena.reset();
+  EXPECT_EQ(arena.make<int64_t>(50000).data(), first);
+}
+
+TEST(arena_tests, check_reserve) {
+  ppc::core::Arena arena;
+  arena.reserve(size_t{1} << 20);
+  EXPECT_EQ(arena.num_blocks(), 1u);
+  EXPECT_GE(arena.capacity(), size_t{1} << 20);
+  arena.make<char>(size_t{1} << 20);
+  EXPECT_EQ(arena.num_blocks(), 1u);
+}
@@ -0,0 +1,82 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <span>
+
+#include "core/memory/include/numa_allocator.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+void check_buffer(const ppc::core::MemoryOptions& options) {
+  ppc::core::numa_vector<int64_t> in(1 << 20, 0, ppc::core::NumaAllocator<int64_t>(options));
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(in.data()) % 4096, 0u);
+  EXPECT_EQ(std::accumulate(in.begin(), in.end(), int64_t{0}), 0);
+  std::iota(in.begin(), in.end(), 0);
+  auto count = static_cast<int64_t>(in.size());
+  EXPECT_EQ(std::accumulate(in.begin(), in.end(), int64_t{0}), count * (count - 1) / 2);
+}
+
+}  // namespace
+
+TEST(numa_allocator_tests, check_policies) {
+  EXPECT_GE(ppc::core::numa_node_count(), 1u);
+  for (auto policy : {ppc::core::NumaPolicy::DEFAULT, ppc::core::NumaPolicy::LOCAL,
+                      ppc::core::NumaPolicy::INTERLEAVE}) {
+    ppc::core::MemoryOptions options;
+    options.policy = policy;
+    check_buffer(options);
+    options.huge_pages = true;
+    check_buffer(options);
+  }
+}
+
+TEST(numa_allocator_tests, check_first_touch) {
+  auto in = ppc::core::make_numa_vector<ppc::core::Backend::STL>(size_t{3} << 20, int32_t{7}, 1000);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(in.data()) % 4096, 0u);
+  EXPECT_EQ(std::accumulate(in.begin(), in.end(), int64_t{0}), int64_t{7} * static_cast<int64_t>(in.size()));
+
+  // values of touched buffers are kept
+  std::iota(in.begin(), in.end(), 0);
+  ppc::core::first_touch<ppc::core::Backend::OMP>(std::span<int32_t>(in).subspan(1));
+  EXPECT_EQ(in[0], 0);
+  EXPECT_EQ(in[in.size() - 1], static_cast<int32_t>(in.size() - 1));
+  EXPECT_TRUE(ppc::core::make_numa_vector<ppc::core::Backend::SEQ>(0, 0.0).empty());
+}
+
+TEST(numa_allocator_tests, check_short_buffers) {
+  ppc::core::numa_vector<int> in;
+  for (int i = 0; i < 100000; i++) {
+    in.push_back(i);
+  }
+  EXPECT_EQ(in[77777], 77777);
+  auto* ptr = ppc::core::allocate_pages(10, {});
+  EXPECT_EQ(static_cast<const char*>(ptr)[9], 0);
+  ppc::core::free_pages(ptr, 10);
+}
+
+#ifndef _WIN32
+TEST(numa_allocator_tests, check_default_options) {
+  setenv("PPC_NUMA_POLICY", "interleave", 1);
+  setenv("PPC_HUGE_PAGES", "1", 1);
+  auto options = ppc::core::default_memory_options();
+  EXPECT_EQ(options.policy, ppc::core::NumaPolicy::INTERLEAVE);
+  EXPECT_TRUE(options.huge_pages);
+  unsetenv("PPC_NUMA_POLICY");
+  unsetenv("PPC_HUGE_PAGES");
+  EXPECT_EQ(ppc::core::default_memory_options().policy, ppc::core::NumaPolicy::DEFAULT);
+}
+#endif
+
+TEST(numa_allocator_tests, check_task_data_buffer) {
+  ppc::core::numa_vector<float> in(100000, 1.f);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in.data(), in.size());
+  auto view = taskData->input<float>(0);
+  EXPECT_EQ(view.size(), in.size());
+  EXPECT_EQ(view[99999], 1.f);
+}
@@ -0,0 +1,68 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_ARENA_HPP_
+#define MODULES_CORE_INCLUDE_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+// Monotonic arena: allocations take consecutive parts of blocks and nothing
+// is freed until reset(). Blocks are kept by reset() (merged into one if
+// there were several), so repeated iterations of the same size stop
+// allocating after the first one.
+class Arena {
+ public:
+  static constexpr size_t kMinBlockSize = size_t{64} << 10;
+
+  Arena() = default;
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+  ~Arena();
+
+  void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  // Value-initialized (zeroed for arithmetic types) array of count elements
+  template <class T>
+  std::span<T> make(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>, "destructors of arena objects are never called");
+    if (count == 0) return {};
+    auto *data = static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+    std::uninitialized_value_construct_n(data, count);
+    return {data, count};
+  }
+
+  // Invalidate all allocations, keeping the memory
+  void reset();
+
+  // Make one block of at least bytes, so the following iterations fit in it.
+  // Allocations are invalidated like with reset().
+  void reserve(size_t bytes);
+
+  // Bytes taken since the last reset and bytes of all blocks
+  [[nodiscard]] size_t used() const;
+  [[nodiscard]] size_t capacity() const;
+  [[nodiscard]] size_t num_blocks() const { return blocks.size(); }
+
+ private:
+  struct Block {
+    std::byte *data;
+    size_t size;
+  };
+
+  void add_block(size_t size);
+  void release();
+
+  // allocations take the last block from offset, previous blocks are full
+  std::vector<Block> blocks;
+  size_t offset = 0;
+  size_t full_blocks_size = 0;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_ARENA_HPP_
@@ -0,0 +1,118 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_NUMA_ALLOCATOR_HPP_
+#define MODULES_CORE_INCLUDE_NUMA_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/parallel_reduce.hpp"
+
+namespace ppc::core {
+
+// Placement of pages over NUMA nodes (Linux only, ignored elsewhere):
+// DEFAULT - policy of the process, LOCAL - node of the thread touching a
+// page first, INTERLEAVE - pages round-robin over all nodes
+enum class NumaPolicy : uint8_t { DEFAULT, LOCAL, INTERLEAVE };
+
+struct MemoryOptions {
+  NumaPolicy policy = NumaPolicy::DEFAULT;
+  // Ask for transparent huge pages with madvise
+  bool huge_pages = false;
+};
+
+// Options from PPC_NUMA_POLICY (default, local, interleave) and
+// PPC_HUGE_PAGES (0, 1)
+MemoryOptions default_memory_options();
+
+// Count of NUMA nodes the system has, 1 if it is unknown
+size_t numa_node_count();
+
+// Size of memory pages of the system
+size_t page_size();
+
+// Buffers shorter than this come from operator new aligned to cache lines,
+// pages of them are shared with other allocations and can't be placed
+constexpr size_t kMinPagedAllocation = size_t{64} << 10;
+
+// Zeroed memory of bytes, free it with free_pages() of the same size. Longer
+// buffers are mapped separately and aligned to pages. Throws std::bad_alloc.
+void* allocate_pages(size_t bytes, const MemoryOptions& options);
+void free_pages(void* ptr, size_t bytes);
+
+// Allocator of containers for TaskData buffers and workspaces of tasks.
+// Memory of one allocator can be freed by any other, options affect only
+// new allocations.
+template <class T>
+class NumaAllocator {
+ public:
+  using value_type = T;
+
+  NumaAllocator() : options_(default_memory_options()) {}
+  explicit NumaAllocator(const MemoryOptions& options) : options_(options) {}
+  template <class U>
+  explicit NumaAllocator(const NumaAllocator<U>& other) : options_(other.options()) {}
+
+  T* allocate(size_t count) {
+    if (count > SIZE_MAX / sizeof(T)) throw std::bad_array_new_length();
+    return static_cast<T*>(allocate_pages(count * sizeof(T), options_));
+  }
+
+  void deallocate(T* ptr, size_t count) { free_pages(ptr, count * sizeof(T)); }
+
+  [[nodiscard]] const MemoryOptions& options() const { return options_; }
+
+  template <class U>
+  bool operator==(const NumaAllocator<U>& /*other*/) const {
+    return true;
+  }
+
+ private:
+  MemoryOptions options_;
+};
+
+template <class T>
+using numa_vector = std::vector<T, NumaAllocator<T>>;
+
+// Touch pages of data, which weren't touched yet, on threads of backend B in
+// chunks of parallel_for<B>(0, data.size(), ..., grain). With LOCAL or
+// DEFAULT policy pages are then placed on nodes of the threads running a
+// kernel over the same range with the same grain (with dynamic scheduling
+// only the spread over nodes is the same) instead of the node of the
+// allocating thread. Values of data are kept.
+template <Backend B, class T>
+void first_touch(std::span<T> data, size_t grain = 0) {
+  if (data.empty()) return;
+  auto page = page_size();
+  auto base = reinterpret_cast<std::uintptr_t>(data.data());
+  auto* bytes = reinterpret_cast<volatile unsigned char*>(data.data());
+  parallel_for<B>(
+      0, data.size(),
+      [&](size_t first, size_t last) {
+        // the first byte of the chunk and the first bytes of following pages
+        for (auto offset = first * sizeof(T); offset < last * sizeof(T);
+             offset = ((base + offset) / page + 1) * page - base) {
+          bytes[offset] = bytes[offset];
+        }
+      },
+      grain);
+}
+
+// Vector of count copies of value, its pages are placed by first_touch<B>()
+// before the elements are written
+template <Backend B, class T>
+numa_vector<T> make_numa_vector(size_t count, const T& value = T(), size_t grain = 0,
+                                const MemoryOptions& options = default_memory_options()) {
+  numa_vector<T> res{NumaAllocator<T>(options)};
+  res.reserve(count);
+  first_touch<B>(std::span<T>(res.data(), count), grain);
+  res.assign(count, value);
+  return res;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_NUMA_ALLOCATOR_HPP_
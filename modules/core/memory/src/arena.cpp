@@ -0,0 +1,67 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/memory/include/arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "core/memory/include/numa_allocator.hpp"
+
+ppc::core::Arena::~Arena() { release(); }
+
+void* ppc::core::Arena::allocate(size_t bytes, size_t alignment) {
+  if (!blocks.empty()) {
+    auto& block = blocks.back();
+    auto address = reinterpret_cast<std::uintptr_t>(block.data) + offset;
+    auto padding = (alignment - address % alignment) % alignment;
+    if (offset + padding + bytes <= block.size) {
+      offset += padding + bytes;
+      return block.data + offset - bytes;
+    }
+    full_blocks_size += offset;
+  }
+  // blocks grow geometrically, so a growing iteration needs few of them
+  auto size = std::max({kMinBlockSize, bytes + alignment, blocks.empty() ? 0 : blocks.back().size * 2});
+  add_block(size);
+  auto address = reinterpret_cast<std::uintptr_t>(blocks.back().data);
+  offset = (alignment - address % alignment) % alignment + bytes;
+  return blocks.back().data + offset - bytes;
+}
+
+void ppc::core::Arena::reset() {
+  if (blocks.size() > 1) reserve(capacity());
+  offset = 0;
+  full_blocks_size = 0;
+}
+
+void ppc::core::Arena::reserve(size_t bytes) {
+  offset = 0;
+  full_blocks_size = 0;
+  if (blocks.size() == 1 && blocks.back().size >= bytes) return;
+  release();
+  add_block(std::max(bytes, kMinBlockSize));
+}
+
+size_t ppc::core::Arena::used() const { return full_blocks_size + offset; }
+
+size_t ppc::core::Arena::capacity() const {
+  size_t res = 0;
+  for (const auto& block : blocks) {
+    res += block.size;
+  }
+  return res;
+}
+
+void ppc::core::Arena::add_block(size_t size) {
+  blocks.reserve(blocks.size() + 1);
+  // pages are placed by the thread using them first, the task's own thread
+  blocks.push_back({static_cast<std::byte*>(allocate_pages(size, default_memory_options())), size});
+}
+
+void ppc::core::Arena::release() {
+  for (const auto& block : blocks) {
+    free_pages(block.data, block.size);
+  }
+  blocks.clear();
+  offset = 0;
+  full_blocks_size = 0;
+}
@@ -0,0 +1,135 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/memory/include/numa_allocator.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t kCacheLine = 64;
+constexpr size_t kHugePage = size_t{2} << 20;
+
+using ppc::core::page_size;
+
+size_t round_up(size_t value, size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+// Length of the mapping depends on bytes only, so free_pages() can find it.
+// Buffers of huge pages or longer end at a huge page bound, the tail is
+// never touched and takes no memory.
+size_t mapping_length(size_t bytes) { return round_up(bytes, bytes >= kHugePage ? kHugePage : page_size()); }
+
+#if defined(__linux__)
+// Numbers of nodes from a list like "0-1,3"
+std::vector<size_t> online_nodes() {
+  std::vector<size_t> nodes;
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string range;
+  while (std::getline(file, range, ',')) {
+    auto dash = range.find('-');
+    auto first = std::strtoull(range.c_str(), nullptr, 10);
+    auto last = dash == std::string::npos ? first : std::strtoull(range.c_str() + dash + 1, nullptr, 10);
+    for (auto node = first; node <= last; node++) {
+      nodes.push_back(node);
+    }
+  }
+  return nodes;
+}
+
+// Constants of <numaif.h>, libnuma isn't required for the syscall
+constexpr int kMpolInterleave = 3;
+constexpr int kMpolLocal = 4;
+
+// Failures are ignored, the memory is still usable with the default policy
+void bind_pages(void* ptr, size_t length, ppc::core::NumaPolicy policy) {
+  constexpr size_t kBits = sizeof(unsigned long) * 8;
+  if (policy == ppc::core::NumaPolicy::LOCAL) {
+    syscall(SYS_mbind, ptr, length, kMpolLocal, nullptr, 0, 0);
+  } else if (policy == ppc::core::NumaPolicy::INTERLEAVE) {
+    auto nodes = online_nodes();
+    if (nodes.empty()) return;
+    auto max_node = *std::max_element(nodes.begin(), nodes.end());
+    std::vector<unsigned long> mask(max_node / kBits + 1, 0);
+    for (auto node : nodes) {
+      mask[node / kBits] |= 1UL << (node % kBits);
+    }
+    // the kernel expects one bit more than the mask has
+    syscall(SYS_mbind, ptr, length, kMpolInterleave, mask.data(), mask.size() * kBits + 1, 0);
+  }
+}
+#endif
+
+}  // namespace
+
+ppc::core::MemoryOptions ppc::core::default_memory_options() {
+  MemoryOptions options;
+  if (const char* value = std::getenv("PPC_NUMA_POLICY")) {
+    std::string policy(value);
+    if (policy == "local") options.policy = NumaPolicy::LOCAL;
+    if (policy == "interleave") options.policy = NumaPolicy::INTERLEAVE;
+  }
+  if (const char* value = std::getenv("PPC_HUGE_PAGES")) {
+    options.huge_pages = std::string(value) == "1";
+  }
+  return options;
+}
+
+size_t ppc::core::page_size() {
+#if defined(__linux__)
+  static const auto size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+#else
+  return 4096;
+#endif
+}
+
+size_t ppc::core::numa_node_count() {
+#if defined(__linux__)
+  static const size_t count = std::max<size_t>(online_nodes().size(), 1);
+  return count;
+#else
+  return 1;
+#endif
+}
+
+void* ppc::core::allocate_pages(size_t bytes, const MemoryOptions& options) {
+  if (bytes < kMinPagedAllocation) {
+    void* ptr = ::operator new(std::max<size_t>(bytes, 1), std::align_val_t{kCacheLine});
+    std::memset(ptr, 0, bytes);
+    return ptr;
+  }
+  auto length = mapping_length(bytes);
+#if defined(__linux__)
+  void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+  if (options.huge_pages) madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+  bind_pages(ptr, length, options.policy);
+#else
+  void* ptr = ::operator new(length, std::align_val_t{page_size()});
+  std::memset(ptr, 0, length);
+#endif
+  return ptr;
+}
+
+void ppc::core::free_pages(void* ptr, size_t bytes) {
+  if (ptr == nullptr) return;
+  if (bytes < kMinPagedAllocation) {
+    ::operator delete(ptr, std::align_val_t{kCacheLine});
+    return;
+  }
+#if defined(__linux__)
+  munmap(ptr, mapping_length(bytes));
+#else
+  ::operator delete(ptr, std::align_val_t{page_size()});
+#endif
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/parallel/include/accumulator.hpp"
+#include "core/parallel/include/parallel_reduce.hpp"
+
+static_assert(std::is_same_v<ppc::core::accumulator_t<int8_t>, int64_t>);
+static_assert(std::is_same_v<ppc::core::accumulator_t<int32_t>, int64_t>);
+static_assert(std::is_same_v<ppc::core::accumulator_t<uint8_t>, uint64_t>);
+static_assert(std::is_same_v<ppc::core::accumulator_t<uint32_t>, uint64_t>);
+static_assert(std::is_same_v<ppc::core::accumulator_t<float>, double>);
+static_assert(std::is_same_v<ppc::core::accumulator_t<double>, double>);
+
+TEST(accumulator_tests, check_int32_sum_does_not_overflow) {
+  // sum is about 3 * 10^15, far beyond int32_t
+  std::vector<int32_t> in(3000000, 1 << 30);
+  auto expected = static_cast<int64_t>(in.size()) << 30;
+  EXPECT_EQ(ppc::core::accumulate(std::span<const int32_t>(in)), expected);
+  EXPECT_EQ(ppc::core::parallel_sum<ppc::core::Backend::STL>(std::span<const int32_t>(in)), expected);
+  EXPECT_EQ(ppc::core::parallel_sum<ppc::core::Backend::OMP>(std::span<const int32_t>(in)), expected);
+}
+
+TEST(accumulator_tests, check_float_sum_keeps_precision) {
+  // a float running sum stops growing long before 10^7 additions
+  std::vector<float> in(10000000, 0.1f);
+  auto expected = static_cast<double>(in.size()) * static_cast<double>(0.1f);
+  EXPECT_NEAR(ppc::core::accumulate(std::span<const float>(in)), expected, 1e-3);
+  EXPECT_NEAR(ppc::core::parallel_sum<ppc::core::Backend::STL>(std::span<const float>(in)), expected, 1e-3);
+}
+
+TEST(accumulator_tests, check_kahan_summation) {
+  std::vector<double> in{1.0, 1e100, 1.0, -1e100};
+  std::span<const double> data(in);
+  EXPECT_EQ(ppc::core::accumulate(data), 0.0);
+  EXPECT_EQ(ppc::core::accumulate<ppc::core::Summation::KAHAN>(data), 2.0);
+
+  ppc::core::CompensatedSum<double> left;
+  ppc::core::CompensatedSum<double> right;
+  left.add(1.0);
+  left.add(1e100);
+  right.add(1.0);
+  right.add(-1e100);
+  left.add(right);
+  EXPECT_EQ(left.value(), 2.0);
+}
+
+TEST(accumulator_tests, check_pairwise_summation) {
+  std::vector<double> in(1000000, 0.1);
+  std::span<const double> data(in);
+  auto exact = ppc::core::accumulate<ppc::core::Summation::KAHAN>(data);
+  auto plain = ppc::core::accumulate(data);
+  auto pairwise = ppc::core::accumulate<ppc::core::Summation::PAIRWISE>(data);
+  EXPECT_LT(std::abs(pairwise - exact), std::abs(plain - exact));
+  EXPECT_NEAR(pairwise, exact, 1e-9);
+  EXPECT_NEAR((ppc::core::parallel_sum<ppc::core::Backend::STL, ppc::core::Summation::KAHAN>(data)), exact, 1e-9);
+}
+
+TEST(accumulator_tests, check_integers_ignore_summation) {
+  std::vector<int8_t> in(1000, -100);
+  std::span<const int8_t> data(in);
+  EXPECT_EQ(ppc::core::accumulate(data), -100000);
+  EXPECT_EQ(ppc::core::accumulate<ppc::core::Summation::KAHAN>(data), -100000);
+  EXPECT_EQ(ppc::core::accumulate<ppc::core::Summation::PAIRWISE>(data), -100000);
+}
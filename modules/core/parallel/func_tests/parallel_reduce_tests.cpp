@@ -0,0 +1,154 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/parallel/include/parallel_reduce.hpp"
+
+namespace {
+
+template <ppc::core::Backend B>
+void check_sum(size_t count) {
+  std::vector<int64_t> in(count);
+  std::iota(in.begin(), in.end(), 1);
+  auto expected = static_cast<int64_t>(count) * static_cast<int64_t>(count + 1) / 2;
+  EXPECT_EQ(ppc::core::parallel_reduce<B>(in, 0), expected);
+}
+
+template <ppc::core::Backend B>
+void check_max() {
+  std::vector<int> in(100000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<int>((i * 7919) % 100003);
+  }
+  in[54321] = 1000000;
+  auto max = [](int a, int b) { return std::max(a, b); };
+  EXPECT_EQ(ppc::core::parallel_reduce<B>(in, std::numeric_limits<int>::min(), max), 1000000);
+}
+
+// Count of sign alternations, neighbours across chunk bounds included
+template <ppc::core::Backend B>
+void check_alternations() {
+  std::vector<int> in(50001);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = i % 2 == 0 ? 1 : -1;
+  }
+  auto count = ppc::core::parallel_reduce<B>(
+      size_t{1}, in.size(), size_t{0},
+      [&](size_t first, size_t last) {
+        size_t res = 0;
+        for (auto i = first; i < last; i++) {
+          res += (in[i - 1] < 0) != (in[i] < 0) ? 1 : 0;
+        }
+        return res;
+      },
+      std::plus<>(), 100);
+  EXPECT_EQ(count, in.size() - 1);
+}
+
+// Every index is visited once, each chunk writes its own elements
+template <ppc::core::Backend B>
+void check_for() {
+  std::vector<int> out(100003, 0);
+  ppc::core::parallel_for<B>(0, out.size(), [&](size_t first, size_t last) {
+    for (auto i = first; i < last; i++) {
+      out[i] += static_cast<int>(i % 10);
+    }
+  });
+  int64_t expected = 0;
+  for (size_t i = 0; i < out.size(); i++) {
+    expected += static_cast<int64_t>(i % 10);
+  }
+  EXPECT_EQ(std::accumulate(out.begin(), out.end(), int64_t{0}), expected);
+}
+
+}  // namespace
+
+TEST(parallel_reduce_tests, check_seq) {
+  check_sum<ppc::core::Backend::SEQ>(100000);
+  check_max<ppc::core::Backend::SEQ>();
+  check_alternations<ppc::core::Backend::SEQ>();
+  check_for<ppc::core::Backend::SEQ>();
+}
+
+TEST(parallel_reduce_tests, check_omp) {
+  check_sum<ppc::core::Backend::OMP>(100000);
+  check_max<ppc::core::Backend::OMP>();
+  check_alternations<ppc::core::Backend::OMP>();
+  check_for<ppc::core::Backend::OMP>();
+}
+
+TEST(parallel_reduce_tests, check_stl) {
+  check_sum<ppc::core::Backend::STL>(100000);
+  check_max<ppc::core::Backend::STL>();
+  check_alternations<ppc::core::Backend::STL>();
+  check_for<ppc::core::Backend::STL>();
+}
+
+TEST(parallel_reduce_tests, check_small_and_empty_input) {
+  check_sum<ppc::core::Backend::STL>(0);
+  check_sum<ppc::core::Backend::STL>(3);
+  check_sum<ppc::core::Backend::OMP>(5);
+  std::vector<int> in{2, 3, 7};
+  EXPECT_EQ(ppc::core::parallel_reduce<ppc::core::Backend::OMP>(in, 1, std::multiplies<>()), 42);
+}
+
+TEST(parallel_reduce_tests, check_chunks_are_combined_in_order) {
+  // concatenation isn't commutative, so any reordering of chunks would show
+  std::string expected;
+  for (int i = 0; i < 1000; i++) {
+    expected += static_cast<char>('a' + i % 26);
+  }
+  auto res = ppc::core::parallel_reduce<ppc::core::Backend::STL>(
+      size_t{0}, expected.size(), std::string(),
+      [&](size_t first, size_t last) { return expected.substr(first, last - first); }, std::plus<>(), 7);
+  EXPECT_EQ(res, expected);
+}
+
+TEST(parallel_reduce_tests, check_elements_are_combined_in_order) {
+  // composition of affine maps x -> a * x + b isn't commutative
+  std::vector<std::pair<int64_t, int64_t>> in(20003);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = {static_cast<int64_t>(i % 3 == 0 ? -1 : 1), static_cast<int64_t>(i % 7)};
+  }
+  auto compose = [](std::pair<int64_t, int64_t> f, std::pair<int64_t, int64_t> g) {
+    return std::pair<int64_t, int64_t>{g.first * f.first, g.first * f.second + g.second};
+  };
+  std::pair<int64_t, int64_t> identity{1, 0};
+  auto expected = identity;
+  for (const auto& f : in) {
+    expected = compose(expected, f);
+  }
+  EXPECT_EQ(ppc::core::parallel_reduce<ppc::core::Backend::SEQ>(in, identity, compose), expected);
+  EXPECT_EQ(ppc::core::parallel_reduce<ppc::core::Backend::STL>(in, identity, compose, 1000), expected);
+}
+
+TEST(parallel_reduce_tests, check_reorderable_ops) {
+  EXPECT_TRUE((ppc::core::kReorderableOp<std::plus<>, int64_t>));
+  EXPECT_TRUE((ppc::core::kReorderableOp<std::remove_cvref_t<decltype(std::ranges::max)>, double>));
+  // regrouping changes rounding of floating-point sums
+  EXPECT_FALSE((ppc::core::kReorderableOp<std::plus<>, double>));
+  std::vector<double> in{1e16, 1.0, -1e16, 1.0, 1.0};
+  EXPECT_EQ(ppc::core::parallel_reduce<ppc::core::Backend::SEQ>(in, 0.0), ((((1e16 + 1.0) - 1e16) + 1.0) + 1.0));
+}
+
+TEST(parallel_reduce_tests, check_grain) {
+  EXPECT_EQ(ppc::core::reduce_grain(100, 8), ppc::core::kMinReduceGrain);
+  EXPECT_EQ(ppc::core::reduce_grain(size_t{1} << 24, 8), (size_t{1} << 24) / 32);
+
+  auto [first, last] = ppc::core::split_range(0, 10, 3, 0);
+  EXPECT_EQ(first, 0u);
+  EXPECT_EQ(last, 4u);
+  std::tie(first, last) = ppc::core::split_range(0, 10, 3, 2);
+  EXPECT_EQ(first, 7u);
+  EXPECT_EQ(last, 10u);
+}
@@ -0,0 +1,95 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_ACCUMULATOR_HPP_
+#define MODULES_CORE_INCLUDE_ACCUMULATOR_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace ppc::core {
+
+// Type to accumulate values of T in: integers are widened to 64 bits of the
+// same signedness and float to double, so sums of large inputs don't
+// overflow or lose precision
+template <class T, class Enable = void>
+struct accumulator {
+  using type = T;
+};
+
+template <class T>
+struct accumulator<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+  using type = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+};
+
+template <>
+struct accumulator<float> {
+  using type = double;
+};
+
+template <class T>
+using accumulator_t = typename accumulator<T>::type;
+
+// Summation of floating point values: PLAIN - one running sum, KAHAN -
+// compensated sum (error doesn't grow with count), PAIRWISE - recursive
+// halving (error grows as log of count). Integers are always summed PLAIN.
+enum class Summation : uint8_t { PLAIN, KAHAN, PAIRWISE };
+
+// Neumaier's variant of Kahan summation, it keeps the lost low-order bits
+// also when added values are larger than the running sum
+template <class T>
+class CompensatedSum {
+ public:
+  void add(T value) {
+    auto sum = sum_ + value;
+    if (std::abs(sum_) >= std::abs(value)) {
+      compensation_ += (sum_ - sum) + value;
+    } else {
+      compensation_ += (value - sum) + sum_;
+    }
+    sum_ = sum;
+  }
+
+  void add(const CompensatedSum& other) {
+    add(other.sum_);
+    add(other.compensation_);
+  }
+
+  [[nodiscard]] T value() const { return sum_ + compensation_; }
+
+ private:
+  T sum_ = 0;
+  T compensation_ = 0;
+};
+
+// Sum of data in Acc
+template <Summation S = Summation::PLAIN, class T, class Acc = accumulator_t<T>>
+Acc accumulate(std::span<const T> data) {
+  if constexpr (S == Summation::KAHAN && std::is_floating_point_v<Acc>) {
+    CompensatedSum<Acc> sum;
+    for (auto value : data) {
+      sum.add(static_cast<Acc>(value));
+    }
+    return sum.value();
+  } else if constexpr (S == Summation::PAIRWISE && std::is_floating_point_v<Acc>) {
+    // short blocks are summed plainly, they don't change the order of error
+    constexpr size_t kBlock = 128;
+    if (data.size() > kBlock) {
+      auto half = data.size() / 2;
+      return accumulate<S, T, Acc>(data.first(half)) + accumulate<S, T, Acc>(data.subspan(half));
+    }
+    return accumulate<Summation::PLAIN, T, Acc>(data);
+  } else {
+    Acc res = 0;
+    for (auto value : data) {
+      res += static_cast<Acc>(value);
+    }
+    return res;
+  }
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_ACCUMULATOR_HPP_
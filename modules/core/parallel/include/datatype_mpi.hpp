@@ -0,0 +1,68 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DATATYPE_MPI_HPP_
+#define MODULES_CORE_INCLUDE_DATATYPE_MPI_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/exception.hpp>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core::mpi {
+
+// Types sent straight from their memory: builtin MPI types and types Boost
+// maps to them (BOOST_IS_MPI_DATATYPE), and any other trivially copyable
+// type as its bytes. Boost.MPI serializes everything else (std::vector,
+// classes with serialize()) into an archive, which costs a packing copy and
+// allocations on both sides.
+template <class T>
+concept Transferable = boost::mpi::is_mpi_datatype<T>::value || std::is_trivially_copyable_v<T>;
+
+// MPI datatype of one T, committed once per type for byte-copied types.
+// Processes are expected to share the representation of T, as with any
+// struct sent as bytes.
+template <Transferable T>
+MPI_Datatype datatype() {
+  if constexpr (boost::mpi::is_mpi_datatype<T>::value) {
+    return boost::mpi::get_mpi_datatype<T>();
+  } else {
+    static MPI_Datatype type = [] {
+      MPI_Datatype res;
+      BOOST_MPI_CHECK_RESULT(MPI_Type_contiguous, (static_cast<int>(sizeof(T)), MPI_BYTE, &res));
+      BOOST_MPI_CHECK_RESULT(MPI_Type_commit, (&res));
+      return res;
+    }();
+    return type;
+  }
+}
+
+template <Transferable T>
+void broadcast_value(const boost::mpi::communicator& comm, T& value, int root) {
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast, (&value, 1, datatype<T>(), root, MPI_Comm(comm)));
+}
+
+// Broadcast in place, values must have the same size on all processes
+template <Transferable T>
+void broadcast_buffer(const boost::mpi::communicator& comm, std::span<T> values, int root) {
+  if (values.empty()) return;
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast,
+                         (values.data(), static_cast<int>(values.size()), datatype<T>(), root, MPI_Comm(comm)));
+}
+
+// The size is broadcast first, values of other processes are resized to it
+template <Transferable T>
+void broadcast_buffer(const boost::mpi::communicator& comm, std::vector<T>& values, int root) {
+  size_t size = values.size();
+  broadcast_value(comm, size, root);
+  values.resize(size);
+  broadcast_buffer(comm, std::span<T>(values), root);
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_DATATYPE_MPI_HPP_
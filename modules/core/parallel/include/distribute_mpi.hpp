@@ -0,0 +1,66 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DISTRIBUTE_MPI_HPP_
+#define MODULES_CORE_INCLUDE_DISTRIBUTE_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/parallel_reduce.hpp"
+
+namespace ppc::core::mpi {
+
+// Element counts and displacements of the parts of every process, in the
+// form MPI vector collectives take them
+struct Distribution {
+  std::vector<int> counts;
+  std::vector<int> displs;
+};
+
+// count elements in num_procs contiguous parts, sizes differ by at most one
+// and the remainder goes to the first processes
+inline Distribution balanced_distribution(size_t count, int num_procs) {
+  Distribution res;
+  res.counts.resize(num_procs);
+  res.displs.resize(num_procs);
+  for (int proc = 0; proc < num_procs; proc++) {
+    auto [first, last] = split_range(0, count, num_procs, proc);
+    res.counts[proc] = static_cast<int>(last - first);
+    res.displs[proc] = static_cast<int>(first);
+  }
+  return res;
+}
+
+// Scatter data of root over all processes of comm in balanced parts with one
+// collective call instead of a send per process, Transferable types without
+// serialization. The size of data is broadcast from root, data is not used
+// on other processes. local receives the part of the calling process (its
+// capacity is kept between calls) and the returned span views it.
+template <class T>
+std::span<const T> distribute(const boost::mpi::communicator& comm, std::span<const T> data, std::vector<T>& local,
+                              int root = 0) {
+  size_t count = comm.rank() == root ? data.size() : 0;
+  boost::mpi::broadcast(comm, count, root);
+  auto distribution = balanced_distribution(count, comm.size());
+  local.resize(distribution.counts[comm.rank()]);
+  if (count == 0) return local;
+  if constexpr (Transferable<T>) {
+    BOOST_MPI_CHECK_RESULT(MPI_Scatterv, (data.data(), distribution.counts.data(), distribution.displs.data(),
+                                          datatype<T>(), local.data(), static_cast<int>(local.size()),
+                                          datatype<T>(), root, MPI_Comm(comm)));
+  } else if (comm.rank() == root) {
+    boost::mpi::scatterv(comm, data.data(), distribution.counts, distribution.displs, local.data(),
+                         static_cast<int>(local.size()), root);
+  } else {
+    boost::mpi::scatterv(comm, local.data(), static_cast<int>(local.size()), root);
+  }
+  return local;
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_DISTRIBUTE_MPI_HPP_
@@ -0,0 +1,88 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_HYBRID_MPI_HPP_
+#define MODULES_CORE_INCLUDE_HYBRID_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "core/parallel/include/parallel_reduce.hpp"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ppc::core::mpi {
+
+// Hybrid mode (USE_MPI_HYBRID): a process runs per node or socket instead of
+// per core, run() of tasks spreads its part over threads of kRankBackend and
+// only the main thread calls MPI. Without it processes stay single-threaded.
+#if defined(PPC_MPI_HYBRID) && defined(_OPENMP)
+inline constexpr bool kHybridMode = true;
+inline constexpr Backend kRankBackend = Backend::OMP;
+inline constexpr auto kThreadingLevel = boost::mpi::threading::funneled;
+#else
+inline constexpr bool kHybridMode = false;
+inline constexpr Backend kRankBackend = Backend::SEQ;
+inline constexpr auto kThreadingLevel = boost::mpi::threading::single;
+#endif
+
+// Processes of comm sharing memory with the calling one (on its node)
+inline boost::mpi::communicator node_communicator(const boost::mpi::communicator& comm) {
+  MPI_Comm node;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_split_type,
+                         (MPI_Comm(comm), MPI_COMM_TYPE_SHARED, comm.rank(), MPI_INFO_NULL, &node));
+  return {node, boost::mpi::comm_take_ownership};
+}
+
+// Threads for one of node_size processes of a node: PPC_NUM_THREADS if set,
+// the CPUs the launcher bound the process to (e.g. a socket), or an equal
+// share of hardware threads of the node for unbound processes
+inline size_t rank_num_threads(int node_size) {
+  if (const char* value = std::getenv("PPC_NUM_THREADS")) {
+    auto count = std::strtoull(value, nullptr, 10);
+    if (count > 0) return count;
+  }
+  auto hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+#if defined(__linux__)
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+    auto bound = static_cast<size_t>(CPU_COUNT(&allowed));
+    if (bound < hardware) return std::max<size_t>(bound, 1);
+  }
+#endif
+  return std::max<size_t>(hardware / std::max(node_size, 1), 1);
+}
+
+// Set up threads of the processes of comm, call once after the environment
+// was created with kThreadingLevel. PPC_NUM_THREADS is set for the thread
+// pool when missing. Returns the count of threads of the calling process,
+// 1 without the hybrid mode or when MPI didn't provide kThreadingLevel.
+inline size_t init_hybrid(const boost::mpi::communicator& comm) {
+  if (!kHybridMode || boost::mpi::environment::thread_level() < kThreadingLevel) return 1;
+  auto num_threads = rank_num_threads(node_communicator(comm).size());
+  if (std::getenv("PPC_NUM_THREADS") == nullptr) {
+#if defined(_WIN32)
+    _putenv_s("PPC_NUM_THREADS", std::to_string(num_threads).c_str());
+#else
+    setenv("PPC_NUM_THREADS", std::to_string(num_threads).c_str(), 1);
+#endif
+  }
+#ifdef _OPENMP
+  omp_set_num_threads(static_cast<int>(num_threads));
+#endif
+  return num_threads;
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_HYBRID_MPI_HPP_
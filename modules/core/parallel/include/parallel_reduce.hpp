@@ -0,0 +1,233 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
+#define MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/parallel/include/accumulator.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if __has_include(<oneapi/tbb/parallel_reduce.h>)
+#include <oneapi/tbb/blocked_range.h>
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_reduce.h>
+#include <oneapi/tbb/task_arena.h>
+#define PPC_HAS_TBB 1
+#else
+#define PPC_HAS_TBB 0
+#endif
+
+namespace ppc::core {
+
+// Backend running chunks of a reduction: OMP falls back to SEQ when the
+// translation unit is built without OpenMP, STL uses ThreadPool::instance()
+// and TBB runs in tbb_arena()
+enum class Backend : uint8_t { SEQ, OMP, STL, TBB };
+
+// Chunks shorter than this cost more to schedule than to reduce
+constexpr size_t kMinReduceGrain = 4096;
+
+#if PPC_HAS_TBB
+// Arena shared by all tasks of the process, it has as many threads as
+// ThreadPool::instance(), so PPC_NUM_THREADS limits the TBB backend too
+inline oneapi::tbb::task_arena& tbb_arena() {
+  static oneapi::tbb::task_arena arena(static_cast<int>(ThreadPool::default_num_threads()));
+  return arena;
+}
+#endif
+
+// Count of threads the backend runs chunks on
+template <Backend B>
+size_t backend_num_threads() {
+  if constexpr (B == Backend::STL) {
+    return ThreadPool::instance().size() + 1;
+#ifdef _OPENMP
+  } else if constexpr (B == Backend::OMP) {
+    return static_cast<size_t>(omp_get_max_threads());
+#endif
+#if PPC_HAS_TBB
+  } else if constexpr (B == Backend::TBB) {
+    return static_cast<size_t>(tbb_arena().max_concurrency());
+#endif
+  } else {
+    return 1;
+  }
+}
+
+// Grain for count elements on num_threads: about four chunks per thread for
+// balance of load, but not shorter than kMinReduceGrain
+inline size_t reduce_grain(size_t count, size_t num_threads) {
+  return std::max(kMinReduceGrain, count / (std::max<size_t>(num_threads, 1) * 4));
+}
+
+// Bounds of chunk-th of num_chunks nearly equal parts of [begin, end)
+inline std::pair<size_t, size_t> split_range(size_t begin, size_t end, size_t num_chunks, size_t chunk) {
+  auto count = end - begin;
+  auto base = count / num_chunks;
+  auto remainder = count % num_chunks;
+  auto first = begin + chunk * base + std::min(chunk, remainder);
+  return {first, first + base + (chunk < remainder ? 1 : 0)};
+}
+
+// Operations whose result doesn't depend on order and grouping of operands:
+// sums and products of integers, minimum and maximum of numbers. Independent
+// accumulators of reduce_values() regroup elements, which is only done for
+// them; floating-point sums keep the order of elements.
+template <class Op, class T>
+inline constexpr bool kReorderableOp =
+    (std::is_integral_v<T> && (std::is_same_v<Op, std::plus<>> || std::is_same_v<Op, std::plus<T>> ||
+                               std::is_same_v<Op, std::multiplies<>> || std::is_same_v<Op, std::multiplies<T>>)) ||
+    (std::is_arithmetic_v<T> && (std::is_same_v<Op, std::remove_cvref_t<decltype(std::ranges::min)>> ||
+                                 std::is_same_v<Op, std::remove_cvref_t<decltype(std::ranges::max)>>));
+
+// Sequential reduce of [first, last). kReorderableOp operations are spread
+// over independent accumulators, which break the dependency chain, so the
+// compiler can keep them in vector registers; other operations combine the
+// elements one by one in order.
+template <class T, class Op>
+T reduce_values(const T* first, const T* last, T identity, Op op) {
+  if constexpr (kReorderableOp<Op, T>) {
+    T acc0 = identity;
+    T acc1 = identity;
+    T acc2 = identity;
+    T acc3 = identity;
+    for (; last - first >= 4; first += 4) {
+      acc0 = op(acc0, first[0]);
+      acc1 = op(acc1, first[1]);
+      acc2 = op(acc2, first[2]);
+      acc3 = op(acc3, first[3]);
+    }
+    for (; first != last; first++) {
+      acc0 = op(acc0, *first);
+    }
+    return op(op(acc0, acc1), op(acc2, acc3));
+  } else {
+    T acc = identity;
+    for (; first != last; first++) {
+      acc = op(acc, *first);
+    }
+    return acc;
+  }
+}
+
+// Reduce [begin, end) on backend B: map(first, last) gives value of a chunk,
+// values of chunks are combined in order with reduce(lhs, rhs) starting from
+// identity. grain == 0 - chosen by reduce_grain(), inputs not longer than the
+// grain are reduced in the calling thread. Exceptions of map are passed
+// through except for OMP, where they terminate the program.
+template <Backend B, class T, class Map, class Reduce>
+T parallel_reduce(size_t begin, size_t end, T identity, Map&& map, Reduce&& reduce, size_t grain = 0) {
+  static_assert(B != Backend::TBB || PPC_HAS_TBB, "TBB backend requires oneTBB headers");
+  if (begin >= end) return identity;
+  auto count = end - begin;
+  if (grain == 0) grain = reduce_grain(count, backend_num_threads<B>());
+  if (B == Backend::SEQ || count <= grain) return reduce(std::move(identity), map(begin, end));
+
+  if constexpr (B == Backend::STL) {
+    return ThreadPool::instance().parallel_reduce(begin, end, std::move(identity), map, reduce, grain);
+#if PPC_HAS_TBB
+  } else if constexpr (B == Backend::TBB) {
+    return tbb_arena().execute([&] {
+      return oneapi::tbb::parallel_reduce(
+          oneapi::tbb::blocked_range<size_t>(begin, end, grain), identity,
+          [&](const oneapi::tbb::blocked_range<size_t>& range, T acc) {
+            return reduce(std::move(acc), map(range.begin(), range.end()));
+          },
+          reduce);
+    });
+#endif
+#ifdef _OPENMP
+  } else if constexpr (B == Backend::OMP) {
+    auto num_chunks = std::min(count / grain, backend_num_threads<B>() * 4);
+    std::vector<T> partial(num_chunks, identity);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t chunk = 0; chunk < static_cast<int64_t>(num_chunks); chunk++) {
+      auto [first, last] = split_range(begin, end, num_chunks, chunk);
+      partial[chunk] = map(first, last);
+    }
+    T res = std::move(identity);
+    for (auto& value : partial) {
+      res = reduce(std::move(res), std::move(value));
+    }
+    return res;
+#endif
+  } else {
+    return reduce(std::move(identity), map(begin, end));
+  }
+}
+
+// Call body(first, last) for chunks of [begin, end) on backend B, chunks are
+// not shorter than grain (chosen by reduce_grain() when 0)
+template <Backend B, class Body>
+void parallel_for(size_t begin, size_t end, Body&& body, size_t grain = 0) {
+  static_assert(B != Backend::TBB || PPC_HAS_TBB, "TBB backend requires oneTBB headers");
+  if (begin >= end) return;
+  auto count = end - begin;
+  if (grain == 0) grain = reduce_grain(count, backend_num_threads<B>());
+  if (B == Backend::SEQ || count <= grain) {
+    body(begin, end);
+    return;
+  }
+
+  if constexpr (B == Backend::STL) {
+    ThreadPool::instance().parallel_for(begin, end, body, grain);
+#if PPC_HAS_TBB
+  } else if constexpr (B == Backend::TBB) {
+    tbb_arena().execute([&] {
+      oneapi::tbb::parallel_for(
+          oneapi::tbb::blocked_range<size_t>(begin, end, grain),
+          [&](const oneapi::tbb::blocked_range<size_t>& range) { body(range.begin(), range.end()); });
+    });
+#endif
+#ifdef _OPENMP
+  } else if constexpr (B == Backend::OMP) {
+    auto num_chunks = std::min(count / grain, backend_num_threads<B>() * 4);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t chunk = 0; chunk < static_cast<int64_t>(num_chunks); chunk++) {
+      auto [first, last] = split_range(begin, end, num_chunks, chunk);
+      body(first, last);
+    }
+#endif
+  } else {
+    body(begin, end);
+  }
+}
+
+// Reduce elements of contiguous data with op, which has to be associative
+// with identity as its neutral element. Except for kReorderableOp operations
+// elements are combined in order, so op doesn't have to be commutative; they
+// are still grouped by chunks, so floating-point results may depend on grain.
+template <Backend B, std::ranges::contiguous_range Range, class Op = std::plus<>>
+auto parallel_reduce(const Range& data, std::ranges::range_value_t<Range> identity, Op op = {}, size_t grain = 0) {
+  const auto* values = std::ranges::data(data);
+  return parallel_reduce<B>(
+      size_t{0}, std::ranges::size(data), identity,
+      [&](size_t first, size_t last) { return reduce_values(values + first, values + last, identity, op); }, op,
+      grain);
+}
+
+// Sum of data in accumulator_t<T>, chunks are summed with S
+template <Backend B, Summation S = Summation::PLAIN, class T>
+accumulator_t<T> parallel_sum(std::span<const T> data, size_t grain = 0) {
+  return parallel_reduce<B>(
+      size_t{0}, data.size(), accumulator_t<T>{},
+      [&](size_t first, size_t last) { return accumulate<S>(data.subspan(first, last - first)); }, std::plus<>(),
+      grain);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_PARALLEL_REDUCE_HPP_
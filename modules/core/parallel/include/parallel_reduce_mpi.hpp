@@ -0,0 +1,37 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PARALLEL_REDUCE_MPI_HPP_
+#define MODULES_CORE_INCLUDE_PARALLEL_REDUCE_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/parallel/include/distribute_mpi.hpp"
+#include "core/parallel/include/parallel_reduce.hpp"
+
+namespace ppc::core::mpi {
+
+// Reduce data of root over all processes of comm: data is scattered in nearly
+// equal parts, every process reduces its part on backend B and the parts are
+// combined with MPI reduce. The result is valid on root only, data is not
+// used on other processes.
+template <Backend B = Backend::SEQ, class T, class Op = std::plus<>>
+T parallel_reduce(const boost::mpi::communicator& comm, std::span<const T> data, std::type_identity_t<T> identity,
+                  Op op = {}, int root = 0) {
+  std::vector<T> local;
+  distribute(comm, data, local, root);
+
+  T local_res = ppc::core::parallel_reduce<B>(local, identity, op);
+  T res = identity;
+  boost::mpi::reduce(comm, local_res, res, op, root);
+  return res;
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_PARALLEL_REDUCE_MPI_HPP_
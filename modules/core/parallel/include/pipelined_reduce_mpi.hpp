@@ -0,0 +1,111 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PIPELINED_REDUCE_MPI_HPP_
+#define MODULES_CORE_INCLUDE_PIPELINED_REDUCE_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/distribute_mpi.hpp"
+
+namespace ppc::core::mpi {
+
+inline constexpr size_t kPipelineBlocks = 8;
+// Elements of one process in one block, shorter blocks cost more in
+// latency of the extra collectives than they hide
+inline constexpr size_t kMinPipelineBlock = size_t{1} << 14;
+
+// Count of blocks of count elements over num_procs processes, at most
+// max_blocks and 1 for small inputs
+inline size_t pipeline_blocks(size_t count, size_t num_procs, size_t max_blocks = kPipelineBlocks) {
+  return std::clamp<size_t>(count / (num_procs * kMinPipelineBlock), 1, std::max<size_t>(max_blocks, 1));
+}
+
+// Reduce of N arrays of root of the same size, split in blocks that are
+// scattered over comm and computed in a pipeline: the scatter of block k + 1
+// (MPI_Iscatterv) and the reduction of block k - 1 (MPI_Ireduce) are in
+// flight while block_op computes block k. block_op takes the parts of the N
+// arrays of the calling process in a block and returns their partial result.
+// Op must map to an MPI operation (std::plus<R>, boost::mpi::maximum<R>...),
+// partial results of blocks are combined in order on root. The result is
+// valid on root only. local receives the parts of the calling process, its
+// capacity is kept between calls.
+template <size_t N, Transferable T, class R, class BlockOp, class Op = std::plus<R>>
+R pipelined_reduce(const boost::mpi::communicator& comm, std::array<std::span<const T>, N> data,
+                   std::array<std::vector<T>, N>& local, BlockOp block_op, R identity, Op op = {},
+                   size_t max_blocks = kPipelineBlocks, int root = 0) {
+  static_assert(boost::mpi::is_mpi_op<Op, R>::value, "the operation has to map to an MPI operation");
+  size_t count = comm.rank() == root ? data[0].size() : 0;
+  boost::mpi::broadcast(comm, count, root);
+  if (count == 0) return identity;
+
+  auto num_procs = static_cast<size_t>(comm.size());
+  auto rank = static_cast<size_t>(comm.rank());
+  auto num_blocks = pipeline_blocks(count, num_procs, max_blocks);
+
+  // block k is the k-th part of the arrays, distributed like distribute()
+  // does with displacements from the beginning of the arrays
+  std::vector<Distribution> blocks(num_blocks);
+  std::vector<size_t> local_offsets(num_blocks + 1, 0);
+  for (size_t k = 0; k < num_blocks; k++) {
+    auto [first, last] = split_range(0, count, num_blocks, k);
+    blocks[k] = balanced_distribution(last - first, comm.size());
+    for (auto& displ : blocks[k].displs) {
+      displ += static_cast<int>(first);
+    }
+    local_offsets[k + 1] = local_offsets[k] + blocks[k].counts[rank];
+  }
+  for (auto& part : local) {
+    part.resize(local_offsets[num_blocks]);
+  }
+
+  std::vector<MPI_Request> scatters(num_blocks * N, MPI_REQUEST_NULL);
+  auto post_scatter = [&](size_t k) {
+    for (size_t i = 0; i < N; i++) {
+      BOOST_MPI_CHECK_RESULT(MPI_Iscatterv,
+                             (data[i].data(), blocks[k].counts.data(), blocks[k].displs.data(), datatype<T>(),
+                              local[i].data() + local_offsets[k], blocks[k].counts[rank], datatype<T>(), root,
+                              MPI_Comm(comm), &scatters[k * N + i]));
+    }
+  };
+
+  // buffers of MPI_Ireduce must stay in place until it completes
+  std::vector<R> partial(num_blocks, identity);
+  std::vector<R> results(num_blocks, identity);
+  std::vector<MPI_Request> reductions(num_blocks, MPI_REQUEST_NULL);
+  post_scatter(0);
+  for (size_t k = 0; k < num_blocks; k++) {
+    if (k + 1 < num_blocks) post_scatter(k + 1);
+    BOOST_MPI_CHECK_RESULT(MPI_Waitall, (static_cast<int>(N), &scatters[k * N], MPI_STATUSES_IGNORE));
+
+    std::array<std::span<const T>, N> block;
+    for (size_t i = 0; i < N; i++) {
+      block[i] = std::span<const T>(local[i]).subspan(local_offsets[k], blocks[k].counts[rank]);
+    }
+    partial[k] = block_op(block);
+    BOOST_MPI_CHECK_RESULT(MPI_Ireduce, (&partial[k], &results[k], 1, datatype<R>(),
+                                         boost::mpi::is_mpi_op<Op, R>::op(), root, MPI_Comm(comm), &reductions[k]));
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Waitall, (static_cast<int>(num_blocks), reductions.data(), MPI_STATUSES_IGNORE));
+
+  R res = identity;
+  for (const auto& result : results) {
+    res = op(res, result);
+  }
+  return res;
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_PIPELINED_REDUCE_MPI_HPP_
@@ -0,0 +1,110 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SHARED_BUFFER_MPI_HPP_
+#define MODULES_CORE_INCLUDE_SHARED_BUFFER_MPI_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/exception.hpp>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/hybrid_mpi.hpp"
+
+namespace ppc::core::mpi {
+
+// Read-only array of root shared by processes of every node: one process of
+// a node (its leader) allocates an MPI-3 shared memory window, the array is
+// sent once per node to the leaders and all processes of the node read it in
+// place. It replaces a broadcast to every process, which sends and keeps a
+// copy per process. The window is kept between assignments while the arrays
+// fit in it.
+template <Transferable T>
+class SharedBuffer {
+ public:
+  SharedBuffer() = default;
+  SharedBuffer(const SharedBuffer&) = delete;
+  SharedBuffer& operator=(const SharedBuffer&) = delete;
+  ~SharedBuffer() { release(); }
+
+  // Collective over comm, which has to be the same in all calls; data is
+  // used on root only. Views of the previous data are invalidated.
+  void assign(const boost::mpi::communicator& comm, std::span<const T> data, int root = 0) {
+    if (!node) {
+      node = node_communicator(comm);
+      // leaders of nodes, other processes get a null communicator
+      leaders = comm.split(node->rank() == 0 ? 0 : MPI_UNDEFINED, comm.rank());
+    }
+    size_t count = comm.rank() == root ? data.size() : 0;
+    broadcast_value(comm, count, root);
+    if (count > capacity || window == MPI_WIN_NULL) allocate(std::max<size_t>(count, 1));
+    size = count;
+
+    // the leader of the node of root sends data to other leaders; the reduce
+    // is also a barrier after reads of the previous data on the node
+    int root_on_node = 0;
+    boost::mpi::all_reduce(*node, comm.rank() == root ? 1 : 0, root_on_node, boost::mpi::maximum<int>());
+    if (comm.rank() == root) std::copy(data.begin(), data.end(), base);
+    synchronize();
+    if (*leaders) {
+      int source = 0;
+      boost::mpi::all_reduce(*leaders, root_on_node != 0 ? leaders->rank() : -1, source, boost::mpi::maximum<int>());
+      broadcast_buffer(*leaders, std::span<T>(base, size), source);
+    }
+    synchronize();
+  }
+
+  [[nodiscard]] std::span<const T> view() const { return {base, size}; }
+
+ private:
+  void allocate(size_t count) {
+    release();
+    T* local_base = nullptr;
+    auto bytes = static_cast<MPI_Aint>(node->rank() == 0 ? count * sizeof(T) : 0);
+    BOOST_MPI_CHECK_RESULT(MPI_Win_allocate_shared, (bytes, static_cast<int>(sizeof(T)), MPI_INFO_NULL,
+                                                     MPI_Comm(*node), &local_base, &window));
+    MPI_Aint leader_bytes;
+    int disp_unit;
+    BOOST_MPI_CHECK_RESULT(MPI_Win_shared_query, (window, 0, &leader_bytes, &disp_unit, &base));
+    // loads and stores of all processes go in one passive epoch
+    BOOST_MPI_CHECK_RESULT(MPI_Win_lock_all, (MPI_MODE_NOCHECK, window));
+    capacity = count;
+  }
+
+  // Stores of processes of the node become visible to the others
+  void synchronize() {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_sync, (window));
+    node->barrier();
+    BOOST_MPI_CHECK_RESULT(MPI_Win_sync, (window));
+  }
+
+  void release() {
+    if (window == MPI_WIN_NULL) return;
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized == 0) {
+      MPI_Win_unlock_all(window);
+      MPI_Win_free(&window);
+    }
+    window = MPI_WIN_NULL;
+    base = nullptr;
+    capacity = 0;
+    size = 0;
+  }
+
+  std::optional<boost::mpi::communicator> node;
+  std::optional<boost::mpi::communicator> leaders;
+  MPI_Win window = MPI_WIN_NULL;
+  T* base = nullptr;
+  size_t capacity = 0;
+  size_t size = 0;
+};
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_SHARED_BUFFER_MPI_HPP_
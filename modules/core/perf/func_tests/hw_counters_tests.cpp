@@ -0,0 +1,95 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/perf.hpp"
+
+TEST(hw_counters_tests, check_counting) {
+  ppc::core::HwCounters counters;
+
+  std::vector<uint64_t> data(100000, 1);
+  counters.start();
+  volatile uint64_t sum = 0;
+  for (auto value : data) {
+    sum = sum + value;
+  }
+  counters.stop();
+  EXPECT_EQ(sum, data.size());
+
+  for (size_t i = 0; i < ppc::core::HwCounters::NUM_COUNTERS; i++) {
+    auto counter = static_cast<ppc::core::HwCounters::Counter>(i);
+    if (!counters.is_available(counter)) {
+      // counters may be forbidden in containers
+      EXPECT_EQ(counters.value(counter), 0u);
+    }
+  }
+  if (counters.is_available(ppc::core::HwCounters::INSTRUCTIONS)) {
+    EXPECT_GE(counters.value(ppc::core::HwCounters::INSTRUCTIONS), data.size());
+  }
+
+  counters.reset();
+  EXPECT_EQ(counters.value(ppc::core::HwCounters::INSTRUCTIONS), 0u);
+}
+
+TEST(hw_counters_tests, check_threads_started_later_are_partial) {
+  ppc::core::HwCounters counters;
+  counters.start();
+  counters.stop();
+  EXPECT_FALSE(counters.is_partial());
+
+  // counts of a thread started after construction are added when it exits
+  std::atomic<bool> done = false;
+  std::thread worker([&] {
+    while (!done) std::this_thread::yield();
+  });
+  counters.start();
+  counters.stop();
+  EXPECT_EQ(counters.is_partial(), counters.is_available());
+  done = true;
+  worker.join();
+
+  counters.reset();
+  EXPECT_FALSE(counters.is_partial());
+}
+
+TEST(hw_counters_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+  perfAttr->hw_counters = true;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  ppc::core::HwCounters counters;
+  EXPECT_EQ(perfResults->hw_counters.empty(), !counters.is_available());
+  if (perfResults->hw_counters.count("instructions") != 0) {
+    EXPECT_GT(perfResults->hw_counters["instructions"], 0u);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
@@ -0,0 +1,99 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/memory_usage.hpp"
+#include "core/perf/include/perf.hpp"
+
+namespace {
+
+// Allocates a copy of input in every run
+template <class T>
+class AllocatingTestTask : public ppc::test::TestTask<T> {
+ public:
+  using ppc::test::TestTask<T>::TestTask;
+  bool run() override {
+    copy_ = std::make_unique<std::vector<T>>(1000);
+    return ppc::test::TestTask<T>::run();
+  }
+
+ private:
+  std::unique_ptr<std::vector<T>> copy_;
+};
+
+}  // namespace
+
+TEST(memory_usage_tests, check_allocation_stats) {
+  if (!ppc::core::allocation_tracking_available()) GTEST_SKIP() << "operator new is not replaced";
+  ppc::core::set_allocation_tracking(true);
+  auto before = ppc::core::allocation_stats();
+  // explicit calls, unlike new expressions, can't be elided
+  void* ptr = ::operator new(1000);
+  void* aligned = ::operator new(100, std::align_val_t{256});
+  auto after = ppc::core::allocation_stats();
+  ppc::core::set_allocation_tracking(false);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 256, 0u);
+  ::operator delete(aligned, std::align_val_t{256});
+  ::operator delete(ptr);
+
+  EXPECT_GE(after.count - before.count, 2u);
+  EXPECT_GE(after.bytes - before.bytes, 1100u);
+
+  before = ppc::core::allocation_stats();
+  ptr = ::operator new(1000);
+  ::operator delete(ptr);
+  EXPECT_EQ(ppc::core::allocation_stats().count, before.count);
+}
+
+TEST(memory_usage_tests, check_peak_rss) {
+#if defined(__linux__)
+  auto peak = ppc::core::peak_rss_bytes();
+  EXPECT_GT(peak, 0u);
+  std::vector<char> buffer(size_t{64} << 20, 1);
+  EXPECT_GE(ppc::core::peak_rss_bytes(), buffer.size());
+#else
+  GTEST_SKIP() << "peak RSS is checked on Linux only";
+#endif
+}
+
+TEST(memory_usage_tests, check_perf_memory_usage) {
+  if (!ppc::core::allocation_tracking_available()) GTEST_SKIP() << "operator new is not replaced";
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<AllocatingTestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+  perfAttr->memory_usage = true;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+  EXPECT_GE(perfResults->allocations, 2 * perfAttr->num_running);
+  EXPECT_GE(perfResults->allocated_bytes, perfAttr->num_running * 1000 * sizeof(uint32_t));
+  EXPECT_GT(perfResults->peak_rss_bytes, 0u);
+
+  perfAttr->memory_usage = false;
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+  EXPECT_EQ(perfResults->allocations, 0u);
+  EXPECT_EQ(perfResults->peak_rss_bytes, 0u);
+}
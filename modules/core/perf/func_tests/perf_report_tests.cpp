@@ -0,0 +1,88 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf_report.hpp"
+
+TEST(perf_report_tests, check_make_record) {
+  ppc::core::PerfResults perfResults;
+  perfResults.type_of_running = ppc::core::PerfResults::TypeOfRunning::PIPELINE;
+  perfResults.samples_sec = {0.5, 0.25};
+  perfResults.time_sec = 0.75;
+  perfResults.num_processes = 4;
+  perfResults.input_size = 120;
+
+  auto record = ppc::core::PerfReport::make_record("tasks/mpi/example", perfResults);
+  EXPECT_EQ(record.task, "example");
+  EXPECT_EQ(record.backend, "mpi");
+  EXPECT_EQ(record.type_of_running, "pipeline");
+  EXPECT_EQ(record.num_processes, 4u);
+  EXPECT_EQ(record.input_size, 120u);
+  ASSERT_EQ(record.samples_sec.size(), 2u);
+  EXPECT_FALSE(record.host.empty());
+}
+
+TEST(perf_report_tests, check_json) {
+  ppc::core::PerfRecord record;
+  record.task = "example";
+  record.backend = "seq";
+  record.type_of_running = "task_run";
+  record.samples_sec = {0.5, 0.25};
+  record.host = "node\"1";
+  record.phase_time_sec = {0.0, 0.0, 0.75, 0.0};
+  record.section_time_sec = {{"compute", 0.5}, {"reduce", 0.25}};
+  record.hw_counters = {{"cycles", 100}};
+  record.hw_counters_partial = true;
+  record.kernel_variants = {{"ref_sum", "avx2"}};
+  record.isa = "avx2";
+  record.allocations = 3;
+  record.peak_rss_bytes = 4096;
+  record.process_peak_rss_bytes = {4096, 8192};
+
+  auto json = ppc::core::PerfReport::to_json(record);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"task\":\"example\""), std::string::npos);
+  EXPECT_NE(json.find("\"samples_sec\":[0.5,0.25]"), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"node\\\"1\""), std::string::npos);
+  EXPECT_NE(json.find("\"run\":0.75"), std::string::npos);
+  EXPECT_NE(json.find("\"sections_sec\":{\"compute\":0.5,\"reduce\":0.25}"), std::string::npos);
+  EXPECT_NE(json.find("\"hw_counters\":{\"cycles\":100},\"hw_counters_partial\":true"), std::string::npos);
+  EXPECT_NE(json.find("\"kernels\":{\"ref_sum\":\"avx2\"}"), std::string::npos);
+  EXPECT_NE(json.find("\"isa\":\"avx2\""), std::string::npos);
+  EXPECT_NE(json.find("\"memory\":{\"allocations\":3,\"allocated_bytes\":0,\"peak_rss_bytes\":4096,"
+                      "\"process_peak_rss_bytes\":[4096,8192]}"),
+            std::string::npos);
+  EXPECT_EQ(json.find('\n'), std::string::npos);
+}
+
+TEST(perf_report_tests, check_csv_file) {
+  ppc::core::PerfRecord record;
+  record.task = "example";
+  record.backend = "omp";
+  record.type_of_running = "pipeline";
+  record.samples_sec = {1.0, 2.0};
+
+  const std::string path = "perf_report_tests_output.csv";
+  std::remove(path.c_str());
+  ASSERT_EQ(ppc::core::PerfReport::format_from_env(path), ppc::core::PerfReport::Format::CSV);
+  ppc::core::PerfReport::write(path, ppc::core::PerfReport::Format::CSV, record);
+  ppc::core::PerfReport::write(path, ppc::core::PerfReport::Format::CSV, record);
+
+  std::ifstream in(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+  in.close();
+  std::remove(path.c_str());
+
+  ASSERT_EQ(lines.size(), 3u);
+  EXPECT_EQ(lines[0], ppc::core::PerfReport::csv_header());
+  EXPECT_EQ(lines[1].rfind("example,omp,pipeline,", 0), 0u);
+  EXPECT_EQ(lines[1].substr(lines[1].size() - 3), "1;2");
+}
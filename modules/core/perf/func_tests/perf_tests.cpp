@@ -1,6 +1,9 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
@@ -155,3 +158,201 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perfResults->time_sec, 10.0);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_warmup_and_samples) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes with a timer that ticks once per call
+  double ticks = 0.0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  perfAttr->num_warmup = 3;
+  perfAttr->current_timer = [&] { return ticks++; };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  ASSERT_EQ(perfResults->samples_sec.size(), 10u);
+  ASSERT_EQ(perfResults->timestamps_sec.size(), 10u);
+  // every run of pipeline reads timer at its beginning and after each of 4 functions
+  EXPECT_DOUBLE_EQ(perfResults->timestamps_sec[0], 15.0);
+  EXPECT_DOUBLE_EQ(perfResults->timestamps_sec[9], 60.0);
+  EXPECT_DOUBLE_EQ(perfResults->time_sec, 40.0);
+  EXPECT_DOUBLE_EQ(perfResults->median_sec, 4.0);
+  EXPECT_DOUBLE_EQ(perfResults->stddev_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_statistic) {
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  for (int i = 10; i >= 1; i--) {
+    perfResults->samples_sec.push_back(static_cast<double>(i));
+  }
+
+  ppc::core::Perf::calc_perf_statistic(perfResults);
+
+  EXPECT_DOUBLE_EQ(perfResults->min_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perfResults->max_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perfResults->mean_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perfResults->median_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perfResults->p90_sec, 9.1);
+  EXPECT_NEAR(perfResults->p99_sec, 9.91, 1e-9);
+  EXPECT_NEAR(perfResults->stddev_sec, 3.0276503541, 1e-9);
+  EXPECT_DOUBLE_EQ(perfResults->mad_sec, 2.5);
+  EXPECT_GT(perfResults->ci_sec, 0.0);
+}
+
+TEST(perf_tests, check_perf_early_stop) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes with a stable timer
+  double ticks = 0.0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 1000;
+  perfAttr->min_running = 7;
+  perfAttr->max_relative_ci = 0.05;
+  perfAttr->current_timer = [&] { return ticks++; };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  ASSERT_EQ(perfResults->samples_sec.size(), 7u);
+  EXPECT_DOUBLE_EQ(perfResults->ci_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+namespace {
+
+template <class T>
+class SectionTestTask : public ppc::test::TestTask<T> {
+ public:
+  explicit SectionTestTask(std::shared_ptr<ppc::core::TaskData> taskData_) : ppc::test::TestTask<T>(taskData_) {}
+  bool run() override {
+    auto section = this->measure_section("sum");
+    return ppc::test::TestTask<T>::run();
+  }
+};
+
+}  // namespace
+
+TEST(perf_tests, check_perf_phases_and_sections) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto testTask = std::make_shared<SectionTestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes, every call of timer takes one tick
+  double ticks = 0.0;
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 3;
+  perfAttr->current_timer = [&] { return ticks++; };
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  for (size_t phase = 0; phase < ppc::core::PerfResults::NUM_PHASES; phase++) {
+    ASSERT_EQ(perfResults->phase_samples_sec[phase].size(), 3u);
+    EXPECT_DOUBLE_EQ(perfResults->phase_time_sec[phase], 3.0);
+  }
+  ASSERT_EQ(perfResults->section_samples_sec.count("sum"), 1u);
+  EXPECT_EQ(perfResults->section_samples_sec["sum"].size(), 3u);
+  EXPECT_GE(perfResults->section_time_sec["sum"], 0.0);
+
+  perfAnalyzer.task_run(perfAttr, perfResults);
+  EXPECT_DOUBLE_EQ(perfResults->phase_time_sec[ppc::core::PerfResults::RUN], 3.0);
+  EXPECT_DOUBLE_EQ(perfResults->phase_time_sec[ppc::core::PerfResults::VALIDATION], 0.0);
+  EXPECT_EQ(perfResults->section_samples_sec["sum"].size(), 3u);
+}
+
+#ifndef _WIN32
+TEST(perf_tests, check_configuration) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 1;
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perfAnalyzer(testTask);
+
+  const char *previous = std::getenv("PPC_NUM_THREADS");
+  std::string saved = previous != nullptr ? previous : "";
+  const char *previous_omp = std::getenv("OMP_NUM_THREADS");
+  std::string saved_omp = previous_omp != nullptr ? previous_omp : "";
+  unsetenv("PPC_NUM_THREADS");
+  unsetenv("OMP_NUM_THREADS");
+  // without a count of threads the task is taken as single-threaded
+  perfAnalyzer.task_run(perfAttr, perfResults);
+  EXPECT_EQ(perfResults->num_threads, 1u);
+  EXPECT_EQ(perfResults->input_size, in.size());
+  setenv("PPC_NUM_THREADS", "3", 1);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+  EXPECT_EQ(perfResults->num_threads, 3u);
+  perfAttr->num_threads = 2;
+  perfAnalyzer.task_run(perfAttr, perfResults);
+  EXPECT_EQ(perfResults->num_threads, 2u);
+
+  unsetenv("PPC_NUM_THREADS");
+  if (previous != nullptr) setenv("PPC_NUM_THREADS", saved.c_str(), 1);
+  if (previous_omp != nullptr) setenv("OMP_NUM_THREADS", saved_omp.c_str(), 1);
+}
+
+TEST(perf_tests, check_scaled_input_size) {
+  unsetenv("PPC_PERF_INPUT_SCALE");
+  EXPECT_EQ(ppc::core::Perf::scaled_input_size(120), 120u);
+  setenv("PPC_PERF_INPUT_SCALE", "2.5", 1);
+  EXPECT_EQ(ppc::core::Perf::scaled_input_size(120), 300u);
+  setenv("PPC_PERF_INPUT_SCALE", "0.001", 1);
+  EXPECT_EQ(ppc::core::Perf::scaled_input_size(120), 1u);
+  unsetenv("PPC_PERF_INPUT_SCALE");
+}
+#endif
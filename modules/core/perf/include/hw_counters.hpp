@@ -0,0 +1,57 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_HW_COUNTERS_HPP_
+#define MODULES_CORE_INCLUDE_HW_COUNTERS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+// Hardware performance counters of the calling process (Linux perf_event_open).
+// Counters are opened for every thread running at construction, such as
+// workers of thread pools, and are inherited by threads they start later.
+// Inherited counts are added when such a thread exits, so intervals with
+// later threads still running at stop() (e.g. a pool started after
+// construction) are marked partial. Counters which can't be opened (no
+// permissions, containers, virtual machines, other systems) are unavailable
+// and always read as zero.
+class HwCounters {
+ public:
+  enum Counter { CYCLES, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, LLC_LOADS };
+  constexpr const static size_t NUM_COUNTERS = 5;
+
+  HwCounters();
+  HwCounters(const HwCounters&) = delete;
+  HwCounters& operator=(const HwCounters&) = delete;
+  ~HwCounters();
+
+  // true if at least one counter is available
+  [[nodiscard]] bool is_available() const;
+  [[nodiscard]] bool is_available(Counter counter) const;
+  // true if some threads weren't counted in an interval since reset()
+  [[nodiscard]] bool is_partial() const;
+
+  // Count events between start() and stop(), counted events are added to
+  // values, multiplexed counters are scaled to the whole interval
+  void start();
+  void stop();
+  void reset();
+
+  [[nodiscard]] uint64_t value(Counter counter) const;
+  static const char* name(Counter counter);
+
+ private:
+  // descriptors of counters of threads running at construction, the calling
+  // one first
+  std::vector<std::array<int, NUM_COUNTERS>> fds;
+  std::vector<int> threads;
+  std::array<uint64_t, NUM_COUNTERS> values{};
+  bool partial = false;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_HW_COUNTERS_HPP_
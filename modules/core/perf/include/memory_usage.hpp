@@ -0,0 +1,32 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_MEMORY_USAGE_HPP_
+#define MODULES_CORE_INCLUDE_MEMORY_USAGE_HPP_
+
+#include <cstdint>
+
+namespace ppc::core {
+
+struct AllocationStats {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+};
+
+// Allocations of all threads through global operator new are counted while
+// tracking is enabled. Operator new is replaced by the core library unless
+// the build uses sanitizers, which replace it themselves, or defines
+// PPC_DISABLE_ALLOCATION_TRACKING; then tracking is unavailable.
+bool allocation_tracking_available();
+void set_allocation_tracking(bool enabled);
+// Totals since the start of the process
+AllocationStats allocation_stats();
+
+// High-water mark of resident memory of the process in bytes, 0 if unknown
+uint64_t peak_rss_bytes();
+// Start the high-water mark from the current resident memory, false if the
+// system doesn't allow it (the mark then covers the whole process)
+bool reset_peak_rss();
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_MEMORY_USAGE_HPP_
@@ -3,9 +3,12 @@
 #ifndef MODULES_CORE_INCLUDE_PERF_HPP_
 #define MODULES_CORE_INCLUDE_PERF_HPP_
 
+#include <array>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -16,6 +19,27 @@ namespace core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of task's running before measurement (results are dropped)
+  uint64_t num_warmup = 0;
+  // stop measurement when the half-width of the 95% confidence interval of
+  // the mean is less than this fraction of the mean (0.0 - always run
+  // num_running times)
+  double max_relative_ci = 0.0;
+  // minimal count of measured runs before the confidence interval is checked
+  uint64_t min_running = 5;
+  // count of processes and threads used by the task for reports (0 - detect
+  // from environment of MPI, PPC_NUM_THREADS or OMP_NUM_THREADS, 1 if they
+  // aren't set). Threaded tasks should give backend_num_threads<B>().
+  uint64_t num_processes = 0;
+  uint64_t num_threads = 0;
+  // collect hardware performance counters of measured runs when they are
+  // available (also enabled by PPC_PERF_HW_COUNTERS=1). Threads started after
+  // the warmup runs, e.g. a pool started by the first measured run, are
+  // counted only when they exit, results are marked partial then.
+  bool hw_counters = false;
+  // count allocations of measured runs and record peak resident memory
+  // (also enabled by PPC_PERF_MEMORY=1)
+  bool memory_usage = false;
   std::function<double(void)> current_timer = [&] { return 0.0; };
 };
 
@@ -24,6 +48,57 @@ struct PerfResults {
   double time_sec = 0.0;
   enum TypeOfRunning { PIPELINE, TASK_RUN, NONE } type_of_running = NONE;
   constexpr const static double MAX_TIME = 10.0;
+
+  // timer value at the start of each measured run and its duration
+  std::vector<double> timestamps_sec;
+  std::vector<double> samples_sec;
+  // statistics over samples_sec (in seconds)
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+  double mean_sec = 0.0;
+  double median_sec = 0.0;
+  double p90_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  double mad_sec = 0.0;
+  // half-width of the 95% confidence interval of the mean
+  double ci_sec = 0.0;
+
+  // duration of every task's function in each measured run and in total
+  // (task_run measures run only)
+  enum Phase { VALIDATION, PRE_PROCESSING, RUN, POST_PROCESSING };
+  constexpr const static size_t NUM_PHASES = 4;
+  std::array<std::vector<double>, NUM_PHASES> phase_samples_sec;
+  std::array<double, NUM_PHASES> phase_time_sec{};
+  // duration of named sections of task (see Task::measure_section) in each
+  // measured run and in total
+  std::map<std::string, std::vector<double>> section_samples_sec;
+  std::map<std::string, double> section_time_sec;
+
+  // total values of available hardware counters over measured runs by names
+  // of HwCounters (cycles, instructions, cache_misses, branch_misses, llc_loads)
+  std::map<std::string, uint64_t> hw_counters;
+  // true if threads which ran in measured runs weren't counted (see HwCounters)
+  bool hw_counters_partial = false;
+
+  // variants of dispatched kernels which ran in the process by names of
+  // kernels (see dispatch())
+  std::map<std::string, std::string> kernel_variants;
+
+  // allocations through global operator new in measured runs and peak
+  // resident memory of the process during them (see memory_usage.hpp), zero
+  // when they are not collected
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  uint64_t peak_rss_bytes = 0;
+  // peak_rss_bytes of every MPI process (see mpi::gather_memory_usage)
+  std::vector<uint64_t> process_peak_rss_bytes;
+
+  // configuration of measurement for reports
+  uint64_t num_processes = 1;
+  uint64_t num_threads = 1;
+  // total count of input elements
+  uint64_t input_size = 0;
 };
 
 class Perf {
@@ -39,13 +114,23 @@ class Perf {
                     const std::shared_ptr<ppc::core::PerfResults>& perfResults);
   // Check performance of task's run() function
   void task_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::shared_ptr<ppc::core::PerfResults>& perfResults);
-  // Pint results for automation checkers
+  // Pint results for automation checkers, the result is also appended to the
+  // file from PPC_PERF_OUTPUT environment variable (JSON Lines or CSV)
   static void print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults);
+  // Calculate min/median/percentiles/deviations over perfResults->samples_sec
+  static void calc_perf_statistic(const std::shared_ptr<PerfResults>& perfResults);
+  // Size of test input multiplied by PPC_PERF_INPUT_SCALE (1.0 by default),
+  // it is used by scaling sweeps (scripts/run_scaling_sweep.py)
+  static uint64_t scaled_input_size(uint64_t size);
 
  private:
+  using PhaseTimes = std::array<double, PerfResults::NUM_PHASES>;
   std::shared_ptr<Task> task;
-  static void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
-                         const std::shared_ptr<ppc::core::PerfResults>& perfResults);
+  // pipeline gets timestamp of its beginning, fills durations of phases and
+  // returns timestamp of its end
+  void common_run(const std::shared_ptr<PerfAttr>& perfAttr,
+                  const std::function<double(double, PhaseTimes&)>& pipeline,
+                  const std::shared_ptr<ppc::core::PerfResults>& perfResults);
 };
 
 }  // namespace core
@@ -0,0 +1,21 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PERF_MPI_HPP_
+#define MODULES_CORE_INCLUDE_PERF_MPI_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core::mpi {
+
+// Gather peak_rss_bytes of every process of comm into process_peak_rss_bytes
+// of root, all processes have to call it after the measurement
+inline void gather_memory_usage(const boost::mpi::communicator& comm, PerfResults& perfResults, int root = 0) {
+  boost::mpi::gather(comm, perfResults.peak_rss_bytes, perfResults.process_peak_rss_bytes, root);
+}
+
+}  // namespace ppc::core::mpi
+
+#endif  // MODULES_CORE_INCLUDE_PERF_MPI_HPP_
@@ -0,0 +1,74 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_PERF_REPORT_HPP_
+#define MODULES_CORE_INCLUDE_PERF_REPORT_HPP_
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// One performance measurement prepared for machine-readable output
+struct PerfRecord {
+  // task directory name and technology (mpi, omp, seq, stl, tbb)
+  std::string task;
+  std::string backend;
+  // pipeline, task_run or none
+  std::string type_of_running;
+  std::vector<double> samples_sec;
+  double time_sec = 0.0;
+  double min_sec = 0.0;
+  double median_sec = 0.0;
+  double p90_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  double mad_sec = 0.0;
+  uint64_t num_processes = 1;
+  uint64_t num_threads = 1;
+  uint64_t input_size = 0;
+  // total durations of task's functions and of named sections
+  std::array<double, PerfResults::NUM_PHASES> phase_time_sec{};
+  std::map<std::string, double> section_time_sec;
+  // available hardware counters
+  std::map<std::string, uint64_t> hw_counters;
+  bool hw_counters_partial = false;
+  // variants of dispatched kernels by names
+  std::map<std::string, std::string> kernel_variants;
+  // allocations of measured runs and peak resident memory of the process and
+  // of every MPI process
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  uint64_t peak_rss_bytes = 0;
+  std::vector<uint64_t> process_peak_rss_bytes;
+  // information about the machine, isa is the widest instruction set of
+  // dispatched kernels
+  std::string host;
+  std::string os;
+  uint64_t cpu_count = 0;
+  std::string isa;
+};
+
+class PerfReport {
+ public:
+  enum Format { JSON_LINES, CSV };
+
+  // Fill record from results, source_path is a path of the perf test file
+  static PerfRecord make_record(const std::string& source_path, const PerfResults& perfResults);
+  // Serialize one record as a single line without trailing new line
+  static std::string to_json(const PerfRecord& record);
+  static std::string to_csv(const PerfRecord& record);
+  static std::string csv_header();
+  // Append record to file, CSV header is written into an empty file only
+  static void write(const std::string& path, Format format, const PerfRecord& record);
+  // Format from PPC_PERF_FORMAT (json or csv) or from extension of path
+  static Format format_from_env(const std::string& path);
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_PERF_REPORT_HPP_
@@ -0,0 +1,158 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/perf/include/hw_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#endif
+
+namespace {
+
+#if defined(__linux__)
+int open_counter(uint32_t type, uint64_t config, int tid) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  // user space only, it is allowed with the default perf_event_paranoid
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+std::array<int, ppc::core::HwCounters::NUM_COUNTERS> open_counters(int tid) {
+  using ppc::core::HwCounters;
+  std::array<int, HwCounters::NUM_COUNTERS> fds{};
+  fds[HwCounters::CYCLES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, tid);
+  fds[HwCounters::INSTRUCTIONS] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, tid);
+  fds[HwCounters::CACHE_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, tid);
+  fds[HwCounters::BRANCH_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, tid);
+  fds[HwCounters::LLC_LOADS] =
+      open_counter(PERF_TYPE_HW_CACHE,
+                   PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_ACCESS << 16),
+                   tid);
+  return fds;
+}
+
+// Thread ids of the calling process
+std::vector<int> list_threads() {
+  std::vector<int> res;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", error)) {
+    res.push_back(std::atoi(entry.path().filename().c_str()));
+  }
+  return res;
+}
+#endif
+
+}  // namespace
+
+ppc::core::HwCounters::HwCounters() {
+#if defined(__linux__)
+  threads.push_back(static_cast<int>(syscall(SYS_gettid)));
+  fds.push_back(open_counters(threads.back()));
+  if (!is_available()) return;
+  for (auto tid : list_threads()) {
+    if (std::find(threads.begin(), threads.end(), tid) != threads.end()) continue;
+    auto thread_fds = open_counters(tid);
+    // the thread exited, running ones without counters mark stop() partial
+    if (std::ranges::all_of(thread_fds, [](int fd) { return fd < 0; })) continue;
+    threads.push_back(tid);
+    fds.push_back(thread_fds);
+  }
+#endif
+}
+
+ppc::core::HwCounters::~HwCounters() {
+#if defined(__linux__)
+  for (const auto& thread_fds : fds) {
+    for (auto fd : thread_fds) {
+      if (fd >= 0) close(fd);
+    }
+  }
+#endif
+}
+
+bool ppc::core::HwCounters::is_available() const {
+  for (size_t i = 0; i < NUM_COUNTERS; i++) {
+    if (is_available(static_cast<Counter>(i))) return true;
+  }
+  return false;
+}
+
+bool ppc::core::HwCounters::is_available(Counter counter) const { return !fds.empty() && fds[0][counter] >= 0; }
+
+bool ppc::core::HwCounters::is_partial() const { return partial; }
+
+void ppc::core::HwCounters::start() {
+#if defined(__linux__)
+  for (const auto& thread_fds : fds) {
+    for (auto fd : thread_fds) {
+      if (fd < 0) continue;
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+#endif
+}
+
+void ppc::core::HwCounters::stop() {
+#if defined(__linux__)
+  for (const auto& thread_fds : fds) {
+    for (auto fd : thread_fds) {
+      if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+  for (const auto& thread_fds : fds) {
+    for (size_t i = 0; i < NUM_COUNTERS; i++) {
+      if (thread_fds[i] < 0) continue;
+      // value, time enabled, time running
+      uint64_t data[3] = {};
+      if (read(thread_fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) continue;
+      auto scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+      values[i] += static_cast<uint64_t>(static_cast<double>(data[0]) * scale);
+    }
+  }
+  // threads started since construction which are still running
+  if (is_available()) {
+    for (auto tid : list_threads()) {
+      if (std::find(threads.begin(), threads.end(), tid) == threads.end()) partial = true;
+    }
+  }
+#endif
+}
+
+void ppc::core::HwCounters::reset() {
+  values.fill(0);
+  partial = false;
+}
+
+uint64_t ppc::core::HwCounters::value(Counter counter) const { return values[counter]; }
+
+const char* ppc::core::HwCounters::name(Counter counter) {
+  switch (counter) {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case CACHE_MISSES:
+      return "cache_misses";
+    case BRANCH_MISSES:
+      return "branch_misses";
+    case LLC_LOADS:
+      return "llc_loads";
+  }
+  return "unknown";
+}
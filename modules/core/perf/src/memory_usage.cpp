@@ -0,0 +1,121 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/perf/include/memory_usage.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#if defined(PPC_DISABLE_ALLOCATION_TRACKING) || defined(_WIN32) || defined(__SANITIZE_ADDRESS__) || \
+    defined(__SANITIZE_THREAD__)
+#define PPC_TRACK_ALLOCATIONS 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define PPC_TRACK_ALLOCATIONS 0
+#endif
+#endif
+#ifndef PPC_TRACK_ALLOCATIONS
+#define PPC_TRACK_ALLOCATIONS 1
+#endif
+
+namespace {
+
+// Constant-initialized, so allocations of static constructors are safe
+std::atomic<bool> tracking_enabled{false};
+std::atomic<uint64_t> allocation_count{0};
+std::atomic<uint64_t> allocation_bytes{0};
+
+#if PPC_TRACK_ALLOCATIONS
+void count_allocation(std::size_t size) {
+  if (tracking_enabled.load(std::memory_order_relaxed)) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+}
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  count_allocation(size);
+  size = std::max<std::size_t>(size, 1);
+  if (alignment > alignof(std::max_align_t)) {
+    // aligned_alloc requires a size multiple of the alignment
+    size = (size + alignment - 1) / alignment * alignment;
+  }
+  while (true) {
+    void* ptr = alignment > alignof(std::max_align_t) ? std::aligned_alloc(alignment, size) : std::malloc(size);
+    if (ptr != nullptr) return ptr;
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) throw std::bad_alloc();
+    handler();
+  }
+}
+#endif
+
+}  // namespace
+
+#if PPC_TRACK_ALLOCATIONS
+// Replacements of global allocation functions, other forms (nothrow) call
+// these ones in the standard library
+void* operator new(std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { std::free(ptr); }
+#endif
+
+bool ppc::core::allocation_tracking_available() { return PPC_TRACK_ALLOCATIONS != 0; }
+
+void ppc::core::set_allocation_tracking(bool enabled) { tracking_enabled.store(enabled); }
+
+ppc::core::AllocationStats ppc::core::allocation_stats() {
+  return {allocation_count.load(std::memory_order_relaxed), allocation_bytes.load(std::memory_order_relaxed)};
+}
+
+uint64_t ppc::core::peak_rss_bytes() {
+#if defined(__linux__)
+  // VmHWM follows reset_peak_rss(), unlike getrusage()
+  std::ifstream status("/proc/self/status");
+  for (std::string line; std::getline(status, line);) {
+    if (line.rfind("VmHWM:", 0) == 0) return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+  }
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+bool ppc::core::reset_peak_rss() {
+#if defined(__linux__)
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+#else
+  return false;
+#endif
+}
@@ -3,11 +3,75 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <numeric>
 #include <sstream>
+#include <string>
 #include <utility>
 
+#include "core/dispatch/include/dispatch.hpp"
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/memory_usage.hpp"
+#include "core/perf/include/perf_report.hpp"
+
+namespace {
+
+uint64_t get_env_count(std::initializer_list<const char*> names) {
+  for (const auto* name : names) {
+    if (const char* value = std::getenv(name)) {
+      auto count = std::strtoull(value, nullptr, 10);
+      if (count > 0) return count;
+    }
+  }
+  return 0;
+}
+
+void fill_configuration(const ppc::core::PerfAttr& perfAttr, const ppc::core::TaskData& taskData,
+                        ppc::core::PerfResults& perfResults) {
+  perfResults.num_processes = perfAttr.num_processes;
+  if (perfResults.num_processes == 0) {
+    perfResults.num_processes = std::max<uint64_t>(get_env_count({"OMPI_COMM_WORLD_SIZE", "PMI_SIZE"}), 1);
+  }
+  perfResults.num_threads = perfAttr.num_threads;
+  if (perfResults.num_threads == 0) {
+    // tasks are single-threaded unless the launcher or the test says otherwise
+    perfResults.num_threads = std::max<uint64_t>(get_env_count({"PPC_NUM_THREADS", "OMP_NUM_THREADS"}), 1);
+  }
+  perfResults.input_size = 0;
+  for (auto count : taskData.inputs_count) {
+    perfResults.input_size += count;
+  }
+}
+
+// Two-sided 95% quantile of Student's t-distribution
+double student_quantile(uint64_t degrees_of_freedom) {
+  static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                 2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                 2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  const uint64_t table_size = sizeof(table) / sizeof(table[0]);
+  if (degrees_of_freedom == 0) return 0.0;
+  if (degrees_of_freedom <= table_size) return table[degrees_of_freedom - 1];
+  return 1.960;
+}
+
+// Linear interpolation between closest ranks, samples must be sorted
+double percentile(const std::vector<double>& sorted_samples, double p) {
+  if (sorted_samples.empty()) return 0.0;
+  auto pos = p * static_cast<double>(sorted_samples.size() - 1);
+  auto lower = static_cast<size_t>(std::floor(pos));
+  auto upper = std::min(lower + 1, sorted_samples.size() - 1);
+  auto frac = pos - static_cast<double>(lower);
+  return sorted_samples[lower] + (sorted_samples[upper] - sorted_samples[lower]) * frac;
+}
+
+}  // namespace
+
 ppc::core::Perf::Perf(std::shared_ptr<Task> task_) { set_task(std::move(task_)); }
 
 void ppc::core::Perf::set_task(std::shared_ptr<Task> task_) {
@@ -18,14 +82,26 @@ void ppc::core::Perf::set_task(std::shared_ptr<Task> task_) {
 void ppc::core::Perf::pipeline_run(const std::shared_ptr<PerfAttr>& perfAttr,
                                    const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
   perfResults->type_of_running = PerfResults::TypeOfRunning::PIPELINE;
+  fill_configuration(*perfAttr, *task->get_data(), *perfResults);
+  task->prepare(perfResults->input_size);
 
   common_run(
       std::move(perfAttr),
-      [&]() {
+      [&](double begin, PhaseTimes& phases) {
         task->validation();
+        auto validation_end = perfAttr->current_timer();
         task->pre_processing();
+        auto pre_processing_end = perfAttr->current_timer();
         task->run();
+        auto run_end = perfAttr->current_timer();
         task->post_processing();
+        auto end = perfAttr->current_timer();
+
+        phases[PerfResults::VALIDATION] = validation_end - begin;
+        phases[PerfResults::PRE_PROCESSING] = pre_processing_end - validation_end;
+        phases[PerfResults::RUN] = run_end - pre_processing_end;
+        phases[PerfResults::POST_PROCESSING] = end - run_end;
+        return end;
       },
       std::move(perfResults));
 }
@@ -33,10 +109,20 @@ void ppc::core::Perf::pipeline_run(const std::shared_ptr<PerfAttr>& perfAttr,
 void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
                                const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
   perfResults->type_of_running = PerfResults::TypeOfRunning::TASK_RUN;
+  fill_configuration(*perfAttr, *task->get_data(), *perfResults);
+  task->prepare(perfResults->input_size);
 
   task->validation();
   task->pre_processing();
-  common_run(std::move(perfAttr), [&]() { task->run(); }, std::move(perfResults));
+  common_run(
+      std::move(perfAttr),
+      [&](double begin, PhaseTimes& phases) {
+        task->run();
+        auto end = perfAttr->current_timer();
+        phases[PerfResults::RUN] = end - begin;
+        return end;
+      },
+      std::move(perfResults));
   task->post_processing();
 
   task->validation();
@@ -45,14 +131,143 @@ void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
   task->post_processing();
 }
 
-void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
+void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr,
+                                 const std::function<double(double, PhaseTimes&)>& pipeline,
                                  const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
-  auto begin = perfAttr->current_timer();
+  PhaseTimes phases{};
+  for (uint64_t i = 0; i < perfAttr->num_warmup; i++) {
+    pipeline(perfAttr->current_timer(), phases);
+  }
+
+  perfResults->timestamps_sec.clear();
+  perfResults->samples_sec.clear();
+  perfResults->timestamps_sec.reserve(perfAttr->num_running);
+  perfResults->samples_sec.reserve(perfAttr->num_running);
+  for (auto& phase_samples : perfResults->phase_samples_sec) {
+    phase_samples.clear();
+    phase_samples.reserve(perfAttr->num_running);
+  }
+  perfResults->section_samples_sec.clear();
+  perfResults->hw_counters.clear();
+  perfResults->hw_counters_partial = false;
+  perfResults->allocations = 0;
+  perfResults->allocated_bytes = 0;
+  perfResults->peak_rss_bytes = 0;
+
+  std::unique_ptr<HwCounters> counters;
+  if (perfAttr->hw_counters || get_env_count({"PPC_PERF_HW_COUNTERS"}) > 0) {
+    counters = std::make_unique<HwCounters>();
+  }
+  bool memory_usage = perfAttr->memory_usage || get_env_count({"PPC_PERF_MEMORY"}) > 0;
+  if (memory_usage) {
+    reset_peak_rss();
+    set_allocation_tracking(true);
+  }
+
+  // Welford's online mean and variance for the early stop criterion
+  double mean = 0.0;
+  double m2 = 0.0;
+  double total = 0.0;
   for (uint64_t i = 0; i < perfAttr->num_running; i++) {
-    pipeline();
+    phases.fill(0.0);
+    task->reset_section_times();
+
+    // allocations of the measurement itself are not counted
+    auto allocations_before = allocation_stats();
+    if (counters) counters->start();
+    auto begin = perfAttr->current_timer();
+    auto end = pipeline(begin, phases);
+    if (counters) counters->stop();
+    auto allocations_after = allocation_stats();
+    perfResults->allocations += allocations_after.count - allocations_before.count;
+    perfResults->allocated_bytes += allocations_after.bytes - allocations_before.bytes;
+
+    auto sample = end - begin;
+    perfResults->timestamps_sec.push_back(begin);
+    perfResults->samples_sec.push_back(sample);
+    total += sample;
+    for (size_t phase = 0; phase < PerfResults::NUM_PHASES; phase++) {
+      perfResults->phase_samples_sec[phase].push_back(phases[phase]);
+    }
+    for (const auto& [name, time] : task->get_section_times()) {
+      auto& section_samples = perfResults->section_samples_sec[name];
+      section_samples.resize(i, 0.0);
+      section_samples.push_back(time);
+    }
+
+    auto count = static_cast<double>(i + 1);
+    auto delta = sample - mean;
+    mean += delta / count;
+    m2 += delta * (sample - mean);
+
+    if (perfAttr->max_relative_ci > 0.0 && i + 1 >= std::max<uint64_t>(perfAttr->min_running, 2)) {
+      auto ci = student_quantile(i) * std::sqrt(m2 / (count - 1.0) / count);
+      if (ci <= perfAttr->max_relative_ci * mean) break;
+    }
+  }
+  perfResults->time_sec = total;
+  if (memory_usage) {
+    set_allocation_tracking(false);
+    perfResults->peak_rss_bytes = peak_rss_bytes();
+  }
+  for (size_t i = 0; counters && i < HwCounters::NUM_COUNTERS; i++) {
+    auto counter = static_cast<HwCounters::Counter>(i);
+    if (counters->is_available(counter)) {
+      perfResults->hw_counters[HwCounters::name(counter)] = counters->value(counter);
+      perfResults->hw_counters_partial = counters->is_partial();
+    }
+  }
+  perfResults->kernel_variants = used_variants();
+  calc_perf_statistic(perfResults);
+}
+
+void ppc::core::Perf::calc_perf_statistic(const std::shared_ptr<PerfResults>& perfResults) {
+  const auto& samples = perfResults->samples_sec;
+  if (samples.empty()) return;
+
+  auto sorted = samples;
+  std::sort(sorted.begin(), sorted.end());
+  auto count = static_cast<double>(sorted.size());
+
+  perfResults->min_sec = sorted.front();
+  perfResults->max_sec = sorted.back();
+  perfResults->median_sec = percentile(sorted, 0.5);
+  perfResults->p90_sec = percentile(sorted, 0.9);
+  perfResults->p99_sec = percentile(sorted, 0.99);
+
+  double sum = 0.0;
+  for (auto sample : sorted) sum += sample;
+  perfResults->mean_sec = sum / count;
+
+  double sq_sum = 0.0;
+  for (auto sample : sorted) sq_sum += (sample - perfResults->mean_sec) * (sample - perfResults->mean_sec);
+  perfResults->stddev_sec = sorted.size() > 1 ? std::sqrt(sq_sum / (count - 1.0)) : 0.0;
+  perfResults->ci_sec = student_quantile(sorted.size() - 1) * perfResults->stddev_sec / std::sqrt(count);
+
+  for (size_t phase = 0; phase < PerfResults::NUM_PHASES; phase++) {
+    const auto& phase_samples = perfResults->phase_samples_sec[phase];
+    perfResults->phase_time_sec[phase] = std::accumulate(phase_samples.begin(), phase_samples.end(), 0.0);
+  }
+  perfResults->section_time_sec.clear();
+  for (const auto& [name, section_samples] : perfResults->section_samples_sec) {
+    perfResults->section_time_sec[name] = std::accumulate(section_samples.begin(), section_samples.end(), 0.0);
   }
-  auto end = perfAttr->current_timer();
-  perfResults->time_sec = end - begin;
+
+  std::vector<double> deviations(sorted.size());
+  std::transform(sorted.begin(), sorted.end(), deviations.begin(),
+                 [&](double sample) { return std::abs(sample - perfResults->median_sec); });
+  std::sort(deviations.begin(), deviations.end());
+  perfResults->mad_sec = percentile(deviations, 0.5);
+}
+
+uint64_t ppc::core::Perf::scaled_input_size(uint64_t size) {
+  if (const char* value = std::getenv("PPC_PERF_INPUT_SCALE")) {
+    auto scale = std::strtod(value, nullptr);
+    if (scale > 0.0) {
+      return std::max<uint64_t>(static_cast<uint64_t>(std::llround(static_cast<double>(size) * scale)), 1);
+    }
+  }
+  return size;
 }
 
 void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults) {
@@ -89,4 +304,9 @@ void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& p
   }
 
   std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << std::endl;
+
+  if (const char* output_path = std::getenv("PPC_PERF_OUTPUT")) {
+    auto record = PerfReport::make_record(relative_path, *perfResults);
+    PerfReport::write(output_path, PerfReport::format_from_env(output_path), record);
+  }
 }
@@ -0,0 +1,280 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/perf/include/perf_report.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "core/dispatch/include/dispatch.hpp"
+
+namespace {
+
+std::string get_host_name() {
+#if defined(__unix__) || defined(__APPLE__)
+  char buffer[256] = {};
+  if (gethostname(buffer, sizeof(buffer) - 1) == 0) return buffer;
+#else
+  if (const char* name = std::getenv("COMPUTERNAME")) return name;
+#endif
+  return "unknown";
+}
+
+std::string get_os_name() {
+#if defined(_WIN32)
+  return "windows";
+#elif defined(__APPLE__)
+  return "macos";
+#elif defined(__linux__)
+  return "linux";
+#else
+  return "unknown";
+#endif
+}
+
+std::string json_escape(const std::string& str) {
+  std::ostringstream out;
+  for (auto c : str) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          out << c;
+        }
+    }
+  }
+  return out.str();
+}
+
+std::string csv_escape(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) return str;
+  std::string res = "\"";
+  for (auto c : str) {
+    if (c == '"') res += '"';
+    res += c;
+  }
+  return res + "\"";
+}
+
+const std::array<const char*, ppc::core::PerfResults::NUM_PHASES> phase_names = {"validation", "pre_processing", "run",
+                                                                                  "post_processing"};
+
+}  // namespace
+
+ppc::core::PerfRecord ppc::core::PerfReport::make_record(const std::string& source_path,
+                                                         const PerfResults& perfResults) {
+  PerfRecord record;
+
+  // Path looks like ".../tasks/<backend>/<task>/perf_tests/main.cpp"
+  std::vector<std::string> parts;
+  std::string part;
+  for (auto c : source_path) {
+    if (c == '/' || c == '\\') {
+      if (!part.empty()) parts.push_back(part);
+      part.clear();
+    } else {
+      part += c;
+    }
+  }
+  if (!part.empty()) parts.push_back(part);
+  for (size_t i = 0; i + 2 < parts.size(); i++) {
+    if (parts[i] == "tasks") {
+      record.backend = parts[i + 1];
+      record.task = parts[i + 2];
+    }
+  }
+  if (record.task.empty()) record.task = source_path;
+
+  if (perfResults.type_of_running == PerfResults::TypeOfRunning::TASK_RUN) {
+    record.type_of_running = "task_run";
+  } else if (perfResults.type_of_running == PerfResults::TypeOfRunning::PIPELINE) {
+    record.type_of_running = "pipeline";
+  } else {
+    record.type_of_running = "none";
+  }
+
+  record.samples_sec = perfResults.samples_sec;
+  record.time_sec = perfResults.time_sec;
+  record.min_sec = perfResults.min_sec;
+  record.median_sec = perfResults.median_sec;
+  record.p90_sec = perfResults.p90_sec;
+  record.p99_sec = perfResults.p99_sec;
+  record.stddev_sec = perfResults.stddev_sec;
+  record.mad_sec = perfResults.mad_sec;
+  record.num_processes = perfResults.num_processes;
+  record.num_threads = perfResults.num_threads;
+  record.input_size = perfResults.input_size;
+  record.phase_time_sec = perfResults.phase_time_sec;
+  record.section_time_sec = perfResults.section_time_sec;
+  record.hw_counters = perfResults.hw_counters;
+  record.hw_counters_partial = perfResults.hw_counters_partial;
+  record.kernel_variants = perfResults.kernel_variants;
+  record.allocations = perfResults.allocations;
+  record.allocated_bytes = perfResults.allocated_bytes;
+  record.peak_rss_bytes = perfResults.peak_rss_bytes;
+  record.process_peak_rss_bytes = perfResults.process_peak_rss_bytes;
+
+  record.host = get_host_name();
+  record.os = get_os_name();
+  record.cpu_count = std::thread::hardware_concurrency();
+  record.isa = isa_name(active_isa());
+  return record;
+}
+
+std::string ppc::core::PerfReport::to_json(const PerfRecord& record) {
+  std::ostringstream out;
+  out << std::setprecision(10);
+  out << "{\"task\":\"" << json_escape(record.task) << "\"";
+  out << ",\"backend\":\"" << json_escape(record.backend) << "\"";
+  out << ",\"type_of_running\":\"" << json_escape(record.type_of_running) << "\"";
+  out << ",\"time_sec\":" << record.time_sec;
+  out << ",\"min_sec\":" << record.min_sec;
+  out << ",\"median_sec\":" << record.median_sec;
+  out << ",\"p90_sec\":" << record.p90_sec;
+  out << ",\"p99_sec\":" << record.p99_sec;
+  out << ",\"stddev_sec\":" << record.stddev_sec;
+  out << ",\"mad_sec\":" << record.mad_sec;
+  out << ",\"samples_sec\":[";
+  for (size_t i = 0; i < record.samples_sec.size(); i++) {
+    out << (i == 0 ? "" : ",") << record.samples_sec[i];
+  }
+  out << "]";
+  out << ",\"num_processes\":" << record.num_processes;
+  out << ",\"num_threads\":" << record.num_threads;
+  out << ",\"input_size\":" << record.input_size;
+  out << ",\"phases_sec\":{";
+  for (size_t i = 0; i < phase_names.size(); i++) {
+    out << (i == 0 ? "" : ",") << "\"" << phase_names[i] << "\":" << record.phase_time_sec[i];
+  }
+  out << "},\"sections_sec\":{";
+  bool first = true;
+  for (const auto& [name, time] : record.section_time_sec) {
+    out << (first ? "" : ",") << "\"" << json_escape(name) << "\":" << time;
+    first = false;
+  }
+  out << "},\"hw_counters\":{";
+  first = true;
+  for (const auto& [name, value] : record.hw_counters) {
+    out << (first ? "" : ",") << "\"" << json_escape(name) << "\":" << value;
+    first = false;
+  }
+  out << "},\"hw_counters_partial\":" << (record.hw_counters_partial ? "true" : "false");
+  out << ",\"kernels\":{";
+  first = true;
+  for (const auto& [name, variant] : record.kernel_variants) {
+    out << (first ? "" : ",") << "\"" << json_escape(name) << "\":\"" << json_escape(variant) << "\"";
+    first = false;
+  }
+  out << "},\"memory\":{\"allocations\":" << record.allocations << ",\"allocated_bytes\":" << record.allocated_bytes
+      << ",\"peak_rss_bytes\":" << record.peak_rss_bytes << ",\"process_peak_rss_bytes\":[";
+  for (size_t i = 0; i < record.process_peak_rss_bytes.size(); i++) {
+    out << (i == 0 ? "" : ",") << record.process_peak_rss_bytes[i];
+  }
+  out << "]}";
+  out << ",\"host\":{\"name\":\"" << json_escape(record.host) << "\",\"os\":\"" << json_escape(record.os)
+      << "\",\"cpu_count\":" << record.cpu_count << ",\"isa\":\"" << json_escape(record.isa) << "\"}";
+  out << "}";
+  return out.str();
+}
+
+std::string ppc::core::PerfReport::csv_header() {
+  return "task,backend,type_of_running,time_sec,min_sec,median_sec,p90_sec,p99_sec,stddev_sec,mad_sec,"
+         "num_processes,num_threads,input_size,validation_sec,pre_processing_sec,run_sec,post_processing_sec,"
+         "host,os,cpu_count,isa,allocations,allocated_bytes,peak_rss_bytes,process_peak_rss_bytes,sections_sec,"
+         "hw_counters,hw_counters_partial,kernels,samples_sec";
+}
+
+std::string ppc::core::PerfReport::to_csv(const PerfRecord& record) {
+  std::ostringstream out;
+  out << std::setprecision(10);
+  out << csv_escape(record.task) << "," << csv_escape(record.backend) << "," << csv_escape(record.type_of_running);
+  out << "," << record.time_sec << "," << record.min_sec << "," << record.median_sec << "," << record.p90_sec;
+  out << "," << record.p99_sec << "," << record.stddev_sec << "," << record.mad_sec;
+  out << "," << record.num_processes << "," << record.num_threads << "," << record.input_size;
+  for (auto time : record.phase_time_sec) out << "," << time;
+  out << "," << csv_escape(record.host) << "," << csv_escape(record.os) << "," << record.cpu_count << ","
+      << csv_escape(record.isa) << ",";
+  out << record.allocations << "," << record.allocated_bytes << "," << record.peak_rss_bytes << ",";
+  for (size_t i = 0; i < record.process_peak_rss_bytes.size(); i++) {
+    out << (i == 0 ? "" : ";") << record.process_peak_rss_bytes[i];
+  }
+  out << ",";
+  // sections are written as name=time separated by ';'
+  std::ostringstream sections;
+  sections << std::setprecision(10);
+  bool first = true;
+  for (const auto& [name, time] : record.section_time_sec) {
+    sections << (first ? "" : ";") << name << "=" << time;
+    first = false;
+  }
+  out << csv_escape(sections.str()) << ",";
+  std::ostringstream counters;
+  first = true;
+  for (const auto& [name, value] : record.hw_counters) {
+    counters << (first ? "" : ";") << name << "=" << value;
+    first = false;
+  }
+  out << csv_escape(counters.str()) << "," << (record.hw_counters_partial ? 1 : 0) << ",";
+  std::ostringstream kernels;
+  first = true;
+  for (const auto& [name, variant] : record.kernel_variants) {
+    kernels << (first ? "" : ";") << name << "=" << variant;
+    first = false;
+  }
+  out << csv_escape(kernels.str()) << ",";
+  // samples are separated by ';' to keep one record per row
+  for (size_t i = 0; i < record.samples_sec.size(); i++) {
+    out << (i == 0 ? "" : ";") << record.samples_sec[i];
+  }
+  return out.str();
+}
+
+void ppc::core::PerfReport::write(const std::string& path, Format format, const PerfRecord& record) {
+  bool is_empty;
+  {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    is_empty = !in.is_open() || in.tellg() <= 0;
+  }
+
+  std::ofstream out(path, std::ios::app);
+  if (!out.is_open()) {
+    throw std::runtime_error("Can't open perf output file: " + path);
+  }
+  if (format == Format::CSV) {
+    if (is_empty) out << csv_header() << "\n";
+    out << to_csv(record) << "\n";
+  } else {
+    out << to_json(record) << "\n";
+  }
+}
+
+ppc::core::PerfReport::Format ppc::core::PerfReport::format_from_env(const std::string& path) {
+  if (const char* format = std::getenv("PPC_PERF_FORMAT")) {
+    return std::string(format) == "csv" ? Format::CSV : Format::JSON_LINES;
+  }
+  const std::string csv_ext = ".csv";
+  if (path.size() >= csv_ext.size() && path.compare(path.size() - csv_ext.size(), csv_ext.size(), csv_ext) == 0) {
+    return Format::CSV;
+  }
+  return Format::JSON_LINES;
+}
@@ -0,0 +1,76 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+TEST(buffer_desc_tests, check_row_major) {
+  auto desc = ppc::core::BufferDesc::make<float>({3, 4});
+  EXPECT_EQ(desc.dtype, ppc::core::DataType::FLOAT32);
+  EXPECT_EQ(desc.strides, (std::vector<size_t>{4, 1}));
+  EXPECT_EQ(desc.count(), 12u);
+  EXPECT_EQ(desc.extent(), 12u);
+  EXPECT_TRUE(desc.is_contiguous());
+  EXPECT_TRUE(desc.is_row_major());
+  EXPECT_EQ(desc.rows(), 3u);
+  EXPECT_EQ(desc.cols(), 4u);
+}
+
+TEST(buffer_desc_tests, check_col_major_padded) {
+  auto desc = ppc::core::BufferDesc::make<double>({3, 4}, ppc::core::Layout::COL_MAJOR, 8);
+  EXPECT_EQ(desc.strides, (std::vector<size_t>{1, 8}));
+  EXPECT_EQ(desc.extent(), 27u);
+  EXPECT_FALSE(desc.is_contiguous());
+  EXPECT_TRUE(desc.is_col_major());
+  ASSERT_ANY_THROW(ppc::core::BufferDesc::make<double>({3, 4}, ppc::core::Layout::COL_MAJOR, 2));
+}
+
+TEST(buffer_desc_tests, check_task_data_matrix) {
+  // Create data of 2x3 matrix with rows padded to 4 elements
+  std::vector<int32_t> in = {1, 2, 3, 0, 4, 5, 6, 0};
+  std::vector<int32_t> out(2, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in.data(), ppc::core::BufferDesc::make<int32_t>({2, 3}, ppc::core::Layout::ROW_MAJOR, 4));
+  taskData->add_output(out.data(), out.size());
+
+  ASSERT_EQ(taskData->inputs_count[0], 7u);
+  ASSERT_NE(taskData->input_desc(0), nullptr);
+  EXPECT_EQ(taskData->input_desc(0)->cols(), 3u);
+
+  auto matrix = taskData->input_matrix<int32_t>(0);
+  ASSERT_EQ(matrix.rows(), 2u);
+  ASSERT_EQ(matrix.cols(), 3u);
+  EXPECT_EQ(matrix(1, 2), 6);
+
+  ASSERT_THROW(taskData->input<float>(0), std::invalid_argument);
+  ASSERT_THROW(taskData->output_matrix<int32_t>(0), std::invalid_argument);
+}
+
+TEST(buffer_desc_tests, check_too_long_buffer) {
+  // the extent doesn't fit in inputs_count, the buffer itself isn't read
+  std::vector<float> in(1);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  ASSERT_THROW(taskData->add_input(in.data(), ppc::core::BufferDesc::make<float>({size_t{1} << 16, size_t{1} << 16})),
+               std::invalid_argument);
+  EXPECT_TRUE(taskData->inputs.empty());
+  EXPECT_TRUE(taskData->inputs_count.empty());
+}
+
+TEST(buffer_desc_tests, check_mixed_with_raw_buffers) {
+  std::vector<int32_t> raw(4, 1);
+  std::vector<double> typed(4, 1.0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(raw.data()));
+  taskData->inputs_count.emplace_back(raw.size());
+  taskData->add_input(typed.data(), typed.size());
+
+  EXPECT_EQ(taskData->input_desc(0), nullptr);
+  ASSERT_NE(taskData->input_desc(1), nullptr);
+  EXPECT_EQ(taskData->input_desc(1)->dtype, ppc::core::DataType::FLOAT64);
+  EXPECT_EQ(taskData->input<double>(1).size(), typed.size());
+}
@@ -134,6 +134,7 @@ TEST(task_tests, check_float) {
   EXPECT_NEAR(out[0], in.size(), 1e-3);
 }
 
+#ifndef PPC_DISABLE_ORDER_TEST
 TEST(task_tests, check_wrong_order) {
   // Create data
   std::vector<float> in(20, 1);
@@ -153,6 +154,151 @@ TEST(task_tests, check_wrong_order) {
   testTask.pre_processing();
   ASSERT_ANY_THROW(testTask.post_processing());
 }
+#endif
+
+#ifndef PPC_DISABLE_ORDER_TEST
+TEST(task_tests, check_wrong_first_function) {
+  // Create data
+  std::vector<float> in(20, 1);
+  std::vector<float> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::TestTask<float> testTask(taskData);
+  ASSERT_ANY_THROW(testTask.run());
+}
+#endif
+
+TEST(task_tests, check_repeated_pipeline) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::TestTask<int32_t> testTask(taskData);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(testTask.validation());
+    testTask.pre_processing();
+    testTask.run();
+    testTask.run();
+    testTask.post_processing();
+  }
+  ASSERT_EQ(static_cast<size_t>(out[0]), 2 * in.size());
+}
+
+TEST(task_tests, check_rebind) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  std::vector<int32_t> other_in(10, 2);
+  std::vector<int32_t> other_out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  std::shared_ptr<ppc::core::TaskData> otherTaskData = std::make_shared<ppc::core::TaskData>();
+  otherTaskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(other_in.data()));
+  otherTaskData->inputs_count.emplace_back(other_in.size());
+  otherTaskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(other_out.data()));
+  otherTaskData->outputs_count.emplace_back(other_out.size());
+
+  // Create Task
+  ppc::test::TestTask<int32_t> testTask(taskData);
+  taskData->state_of_testing = ppc::core::TaskData::StateOfTesting::PERF;
+  testTask.prepare(in.size());
+  ASSERT_TRUE(testTask.validation());
+  testTask.pre_processing();
+
+  // Rebind in the middle of pipeline restarts it from validation
+  testTask.rebind(otherTaskData);
+  EXPECT_EQ(testTask.get_data(), otherTaskData);
+  EXPECT_EQ(otherTaskData->state_of_testing, ppc::core::TaskData::StateOfTesting::PERF);
+  ASSERT_TRUE(testTask.validation());
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+  EXPECT_EQ(out[0], 0);
+  EXPECT_EQ(static_cast<size_t>(other_out[0]), 2 * other_in.size());
+}
+
+TEST(task_tests, check_scratch_is_reused) {
+  // Create data
+  std::vector<int32_t> in(100000, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->add_input(in.data(), in.size());
+  taskData->add_output(out.data(), out.size());
+
+  // Create Task
+  ppc::test::ScratchTask<int32_t> testTask(taskData);
+  const int32_t *first_scratch = nullptr;
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(testTask.validation());
+    testTask.pre_processing();
+    testTask.run();
+    if (first_scratch == nullptr) first_scratch = testTask.scratch_data;
+    EXPECT_EQ(testTask.scratch_data, first_scratch);
+    testTask.run();
+    EXPECT_EQ(testTask.scratch_data, first_scratch);
+    testTask.post_processing();
+    ASSERT_EQ(static_cast<size_t>(out[0]), in.size());
+  }
+}
+
+TEST(task_tests, check_data_views) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  auto input = taskData->input<int32_t>(0);
+  auto output = taskData->output<int32_t>(0);
+  ASSERT_EQ(input.data(), in.data());
+  ASSERT_EQ(input.size(), in.size());
+  output[0] = 5;
+  ASSERT_EQ(out[0], 5);
+
+  ASSERT_THROW(taskData->input<int32_t>(1), std::out_of_range);
+  ASSERT_THROW(taskData->output<int32_t>(1), std::out_of_range);
+}
+
+TEST(task_tests, check_data_views_misaligned) {
+  // Create data
+  std::vector<int64_t> in(20, 1);
+
+  // Create TaskData with shifted pointer
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()) + 1);
+  taskData->inputs_count.emplace_back(in.size() - 1);
+
+  ASSERT_THROW(taskData->input<int64_t>(0), std::invalid_argument);
+  ASSERT_EQ(taskData->input<uint8_t>(0).size(), in.size() - 1);
+}
 
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -47,6 +48,43 @@ class TestTask : public ppc::core::Task {
   T *output_{};
 };
 
+// Sums a copy of input in scratch memory of the task
+template <class T>
+class ScratchTask : public ppc::core::Task {
+ public:
+  explicit ScratchTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
+  bool pre_processing() override {
+    internal_order_test();
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    return taskData->outputs_count[0] == 1;
+  }
+
+  bool run() override {
+    internal_order_test();
+    auto input = taskData->input<T>(0);
+    auto copy = scratch<T>(input.size());
+    std::copy(input.begin(), input.end(), copy.begin());
+    auto sum = scratch<T>(1);
+    for (auto value : copy) {
+      sum[0] += value;
+    }
+    taskData->output<T>(0)[0] = sum[0];
+    scratch_data = copy.data();
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    return true;
+  }
+
+  const T *scratch_data{};
+};
+
 }  // namespace ppc::test
 
 #endif  // MODULES_CORE_TESTS_TEST_TASK_HPP_
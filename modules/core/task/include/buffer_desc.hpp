@@ -0,0 +1,130 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_BUFFER_DESC_HPP_
+#define MODULES_CORE_INCLUDE_BUFFER_DESC_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+enum class DataType : uint8_t { UNKNOWN, INT8, UINT8, INT16, UINT16, INT32, UINT32, INT64, UINT64, FLOAT32, FLOAT64 };
+
+template <class T>
+constexpr DataType data_type_of() {
+  using U = std::remove_cv_t<T>;
+  if constexpr (std::is_same_v<U, float>) return DataType::FLOAT32;
+  if constexpr (std::is_same_v<U, double>) return DataType::FLOAT64;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == 1) return DataType::INT8;
+  if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) == 1) return DataType::UINT8;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == 2) return DataType::INT16;
+  if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) == 2) return DataType::UINT16;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == 4) return DataType::INT32;
+  if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) == 4) return DataType::UINT32;
+  if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == 8) return DataType::INT64;
+  if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) == 8) return DataType::UINT64;
+  return DataType::UNKNOWN;
+}
+
+// Storage order of multidimensional buffer
+enum class Layout : uint8_t { ROW_MAJOR, COL_MAJOR };
+
+// Description of a TaskData buffer: element type, extents and strides (in
+// elements) of every dimension and required alignment of the first element
+struct BufferDesc {
+  DataType dtype = DataType::UNKNOWN;
+  size_t element_size = 0;
+  std::vector<size_t> shape;
+  std::vector<size_t> strides;
+  size_t alignment = 1;
+
+  // Dense buffer, leading_dim != 0 sets padded length of rows (ROW_MAJOR) or
+  // columns (COL_MAJOR)
+  template <class T>
+  static BufferDesc make(std::vector<size_t> shape, Layout layout = Layout::ROW_MAJOR, size_t leading_dim = 0) {
+    BufferDesc desc;
+    desc.dtype = data_type_of<T>();
+    desc.element_size = sizeof(T);
+    desc.alignment = alignof(T);
+    desc.shape = std::move(shape);
+    desc.strides.assign(desc.shape.size(), 1);
+
+    const auto dims = desc.shape.size();
+    if (dims == 0) return desc;
+    size_t stride = 1;
+    if (layout == Layout::ROW_MAJOR) {
+      for (size_t d = dims; d-- > 0;) {
+        desc.strides[d] = stride;
+        stride *= (d == dims - 1 && leading_dim != 0) ? leading_dim : desc.shape[d];
+      }
+      if (leading_dim != 0 && leading_dim < desc.shape[dims - 1]) {
+        throw std::invalid_argument("Leading dimension is less than count of columns");
+      }
+    } else {
+      for (size_t d = 0; d < dims; d++) {
+        desc.strides[d] = stride;
+        stride *= (d == 0 && leading_dim != 0) ? leading_dim : desc.shape[d];
+      }
+      if (leading_dim != 0 && leading_dim < desc.shape[0]) {
+        throw std::invalid_argument("Leading dimension is less than count of rows");
+      }
+    }
+    return desc;
+  }
+
+  // Count of logical elements
+  [[nodiscard]] size_t count() const {
+    size_t res = 1;
+    for (auto extent : shape) res *= extent;
+    return res;
+  }
+
+  // Count of elements the buffer has to hold including padding
+  [[nodiscard]] size_t extent() const {
+    if (count() == 0) return 0;
+    size_t res = 1;
+    for (size_t d = 0; d < shape.size(); d++) res += (shape[d] - 1) * strides[d];
+    return res;
+  }
+
+  [[nodiscard]] bool is_contiguous() const { return extent() == count(); }
+  [[nodiscard]] bool is_row_major() const { return shape.size() < 2 || strides.back() == 1; }
+  [[nodiscard]] bool is_col_major() const { return shape.size() < 2 || strides.front() == 1; }
+
+  // Shortcuts for matrices
+  [[nodiscard]] size_t rows() const { return shape.empty() ? 0 : shape[0]; }
+  [[nodiscard]] size_t cols() const { return shape.size() < 2 ? 1 : shape[1]; }
+};
+
+// Non-owning 2D view of a strided buffer
+template <class T>
+class MatrixView {
+ public:
+  MatrixView() = default;
+  MatrixView(T* data, size_t rows, size_t cols, size_t row_stride, size_t col_stride)
+      : data_(data), rows_(rows), cols_(cols), row_stride_(row_stride), col_stride_(col_stride) {}
+
+  T& operator()(size_t row, size_t col) const { return data_[row * row_stride_ + col * col_stride_]; }
+
+  [[nodiscard]] size_t rows() const { return rows_; }
+  [[nodiscard]] size_t cols() const { return cols_; }
+  [[nodiscard]] size_t row_stride() const { return row_stride_; }
+  [[nodiscard]] size_t col_stride() const { return col_stride_; }
+  [[nodiscard]] T* data() const { return data_; }
+
+ private:
+  T* data_ = nullptr;
+  size_t rows_ = 0;
+  size_t cols_ = 0;
+  size_t row_stride_ = 0;
+  size_t col_stride_ = 0;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_BUFFER_DESC_HPP_
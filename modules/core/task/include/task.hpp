@@ -6,10 +6,19 @@
 #include <chrono>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "core/memory/include/arena.hpp"
+#include "core/task/include/buffer_desc.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -18,6 +27,114 @@ struct TaskData {
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting { FUNC, PERF } state_of_testing;
+
+  // Optional descriptions of buffers, inputs_desc[i] describes inputs[i]
+  std::vector<BufferDesc> inputs_desc;
+  std::vector<BufferDesc> outputs_desc;
+
+  // Add buffer with its description, the count of elements is desc.extent()
+  template <class T>
+  void add_input(T *data, const BufferDesc &desc) {
+    add_buffer(inputs, inputs_count, inputs_desc, data, desc);
+  }
+
+  template <class T>
+  void add_input(T *data, size_t count) {
+    add_input(data, BufferDesc::make<T>({count}));
+  }
+
+  template <class T>
+  void add_output(T *data, const BufferDesc &desc) {
+    add_buffer(outputs, outputs_count, outputs_desc, data, desc);
+  }
+
+  template <class T>
+  void add_output(T *data, size_t count) {
+    add_output(data, BufferDesc::make<T>({count}));
+  }
+
+  // Description of buffer or nullptr if the buffer was added without it
+  [[nodiscard]] const BufferDesc *input_desc(size_t i) const { return find_desc(inputs_desc, i); }
+  [[nodiscard]] const BufferDesc *output_desc(size_t i) const { return find_desc(outputs_desc, i); }
+
+  // Typed views of buffers without copying, the count of elements is taken
+  // from inputs_count/outputs_count
+  template <class T>
+  std::span<const T> input(size_t i) const {
+    return make_view<const T>(inputs, inputs_count, inputs_desc, i, "input");
+  }
+
+  template <class T>
+  std::span<T> output(size_t i) const {
+    return make_view<T>(outputs, outputs_count, outputs_desc, i, "output");
+  }
+
+  // 2D views of buffers described with two dimensions
+  template <class T>
+  MatrixView<const T> input_matrix(size_t i) const {
+    return make_matrix_view<const T>(input<T>(i).data(), input_desc(i), "input");
+  }
+
+  template <class T>
+  MatrixView<T> output_matrix(size_t i) const {
+    return make_matrix_view<T>(output<T>(i).data(), output_desc(i), "output");
+  }
+
+ private:
+  template <class T>
+  static void add_buffer(std::vector<uint8_t *> &buffers, std::vector<std::uint32_t> &counts,
+                         std::vector<BufferDesc> &descs, T *data, const BufferDesc &desc) {
+    if (desc.alignment != 0 && reinterpret_cast<std::uintptr_t>(data) % desc.alignment != 0) {
+      throw std::invalid_argument("TaskData buffer is not aligned as described");
+    }
+    if (desc.dtype != DataType::UNKNOWN && desc.dtype != data_type_of<T>()) {
+      throw std::invalid_argument("TaskData buffer type differs from description");
+    }
+    if (desc.extent() > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::invalid_argument("TaskData buffer is longer than its count can hold");
+    }
+    descs.resize(buffers.size());
+    buffers.emplace_back(reinterpret_cast<uint8_t *>(const_cast<std::remove_const_t<T> *>(data)));
+    counts.emplace_back(static_cast<std::uint32_t>(desc.extent()));
+    descs.emplace_back(desc);
+  }
+
+  static const BufferDesc *find_desc(const std::vector<BufferDesc> &descs, size_t i) {
+    if (i >= descs.size() || descs[i].dtype == DataType::UNKNOWN) return nullptr;
+    return &descs[i];
+  }
+
+  template <class T>
+  static std::span<T> make_view(const std::vector<uint8_t *> &buffers, const std::vector<std::uint32_t> &counts,
+                                const std::vector<BufferDesc> &descs, size_t i, const char *kind) {
+    if (i >= buffers.size() || i >= counts.size()) {
+      throw std::out_of_range(std::string("TaskData has no ") + kind + " with index " + std::to_string(i));
+    }
+    const auto *desc = find_desc(descs, i);
+    if (desc != nullptr && desc->dtype != data_type_of<T>()) {
+      throw std::invalid_argument(std::string("TaskData ") + kind + " " + std::to_string(i) +
+                                  " is described with another type");
+    }
+    if (counts[i] == 0) {
+      return {};
+    }
+    if (buffers[i] == nullptr) {
+      throw std::invalid_argument(std::string("TaskData ") + kind + " " + std::to_string(i) + " is null");
+    }
+    if (reinterpret_cast<std::uintptr_t>(buffers[i]) % alignof(T) != 0) {
+      throw std::invalid_argument(std::string("TaskData ") + kind + " " + std::to_string(i) +
+                                  " is misaligned for requested type");
+    }
+    return {reinterpret_cast<T *>(buffers[i]), counts[i]};
+  }
+
+  template <class T>
+  static MatrixView<T> make_matrix_view(T *data, const BufferDesc *desc, const char *kind) {
+    if (desc == nullptr || desc->shape.size() != 2) {
+      throw std::invalid_argument(std::string("TaskData ") + kind + " is not described as matrix");
+    }
+    return {data, desc->shape[0], desc->shape[1], desc->strides[0], desc->strides[1]};
+  }
 };
 
 // Memory of inputs and outputs need to be initialized before create object of
@@ -29,6 +146,15 @@ class Task {
   // set input and output data
   void set_data(std::shared_ptr<TaskData> taskData_);
 
+  // set new input and output data of the same kind to a task that has already
+  // been run: the state of testing is kept and the next call has to be
+  // validation(), buffers of the task are kept to be reused by pre_processing()
+  void rebind(std::shared_ptr<TaskData> taskData_);
+
+  // reserve buffers and workspaces for inputs of up to capacity elements, so
+  // that following pipelines reuse them instead of allocating
+  virtual void prepare(size_t capacity);
+
   // validation of data and validation of task attributes before running
   virtual bool validation() = 0;
 
@@ -44,17 +170,56 @@ class Task {
   // get input and output data
   [[nodiscard]] std::shared_ptr<TaskData> get_data() const;
 
+  // get durations (in seconds) of named sections accumulated since the last
+  // reset_section_times()
+  [[nodiscard]] const std::vector<std::pair<std::string, double>> &get_section_times() const;
+  void reset_section_times();
+
   virtual ~Task();
 
  protected:
-  void internal_order_test(const std::string &str = __builtin_FUNCTION());
+  // Measure a named part of task's function until the end of scope, e.g.
+  //   auto section = measure_section("scatter");
+  class Section {
+   public:
+    Section(Task &task_, const char *name_);
+    Section(const Section &) = delete;
+    Section &operator=(const Section &) = delete;
+    ~Section();
+
+   private:
+    Task &task;
+    const char *name;
+    std::chrono::steady_clock::time_point begin;
+  };
+  Section measure_section(const char *name) { return {*this, name}; }
+
+  // Zeroed array for temporaries of the running function of the pipeline,
+  // it is valid until internal_order_test() of the next function. Memory is
+  // kept between pipelines, so steady iterations don't allocate.
+  template <class T>
+  std::span<T> scratch(size_t count) {
+    return scratch_arena.make<T>(count);
+  }
+
+  // Check order of calls without allocations, can be compiled out with
+  // PPC_DISABLE_ORDER_TEST definition (DISABLE_ORDER_TEST cmake option)
+  void internal_order_test(std::string_view str = __builtin_FUNCTION());
   std::shared_ptr<TaskData> taskData;
 
  private:
-  std::vector<std::string> functions_order;
-  std::vector<std::string> right_functions_order = {"validation", "pre_processing", "run", "post_processing"};
+  enum class Function : uint8_t { VALIDATION, PRE_PROCESSING, RUN, POST_PROCESSING, UNKNOWN };
+  static Function function_of(std::string_view str);
+  static const char *name_of(Function function);
+
+  // last called function, POST_PROCESSING means the pipeline is expected to
+  // start with validation
+  Function last_function = Function::POST_PROCESSING;
+  uint64_t num_calls = 0;
   const double max_test_time = 1.0;
-  std::chrono::high_resolution_clock::time_point tmp_time_point;
+  std::chrono::steady_clock::time_point tmp_time_point;
+  std::vector<std::pair<std::string, double>> section_times;
+  Arena scratch_arena;
 };
 
 }  // namespace ppc::core
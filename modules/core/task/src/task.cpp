@@ -8,33 +8,67 @@
 
 void ppc::core::Task::set_data(std::shared_ptr<TaskData> taskData_) {
   taskData_->state_of_testing = TaskData::StateOfTesting::FUNC;
-  functions_order.clear();
+  last_function = Function::POST_PROCESSING;
+  num_calls = 0;
   taskData = std::move(taskData_);
 }
 
+void ppc::core::Task::rebind(std::shared_ptr<TaskData> taskData_) {
+  taskData_->state_of_testing = taskData->state_of_testing;
+  last_function = Function::POST_PROCESSING;
+  taskData = std::move(taskData_);
+}
+
+void ppc::core::Task::prepare(size_t /*capacity*/) {}
+
 std::shared_ptr<ppc::core::TaskData> ppc::core::Task::get_data() const { return taskData; }
 
 ppc::core::Task::Task(std::shared_ptr<TaskData> taskData_) { set_data(std::move(taskData_)); }
 
-void ppc::core::Task::internal_order_test(const std::string& str) {
-  if (!functions_order.empty() && str == functions_order.back() && str == "run") return;
+ppc::core::Task::Function ppc::core::Task::function_of(std::string_view str) {
+  if (str == "validation") return Function::VALIDATION;
+  if (str == "pre_processing") return Function::PRE_PROCESSING;
+  if (str == "run") return Function::RUN;
+  if (str == "post_processing") return Function::POST_PROCESSING;
+  return Function::UNKNOWN;
+}
+
+const char* ppc::core::Task::name_of(Function function) {
+  switch (function) {
+    case Function::VALIDATION:
+      return "validation";
+    case Function::PRE_PROCESSING:
+      return "pre_processing";
+    case Function::RUN:
+      return "run";
+    case Function::POST_PROCESSING:
+      return "post_processing";
+    default:
+      return "unknown";
+  }
+}
 
-  functions_order.push_back(str);
+void ppc::core::Task::internal_order_test(std::string_view str) {
+  scratch_arena.reset();
+#ifndef PPC_DISABLE_ORDER_TEST
+  auto function = function_of(str);
+  if (function == Function::RUN && last_function == Function::RUN) return;
 
-  for (size_t i = 0; i < functions_order.size(); i++) {
-    if (functions_order[i] != right_functions_order[i % right_functions_order.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order[i]);
-    }
+  auto expected = static_cast<Function>((static_cast<uint8_t>(last_function) + 1) % 4);
+  if (function != expected) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(num_calls + 1) + "\n" + std::string("Yours function: ") +
+                                std::string(str) + "\n" + std::string("Expected function: ") + name_of(expected));
   }
+  last_function = function;
+  num_calls++;
 
-  if (str == "pre_processing" && taskData->state_of_testing == TaskData::StateOfTesting::FUNC) {
-    tmp_time_point = std::chrono::high_resolution_clock::now();
+  if (function == Function::PRE_PROCESSING && taskData->state_of_testing == TaskData::StateOfTesting::FUNC) {
+    tmp_time_point = std::chrono::steady_clock::now();
   }
 
-  if (str == "post_processing" && taskData->state_of_testing == TaskData::StateOfTesting::FUNC) {
-    auto end = std::chrono::high_resolution_clock::now();
+  if (function == Function::POST_PROCESSING && taskData->state_of_testing == TaskData::StateOfTesting::FUNC) {
+    auto end = std::chrono::steady_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point).count();
     auto current_time = static_cast<double>(duration) * 1e-9;
     if (current_time > max_test_time) {
@@ -42,6 +76,34 @@ void ppc::core::Task::internal_order_test(const std::string& str) {
       EXPECT_TRUE(current_time < max_test_time);
     }
   }
+#else
+  (void)str;
+#endif
+}
+
+const std::vector<std::pair<std::string, double>>& ppc::core::Task::get_section_times() const {
+  return section_times;
+}
+
+void ppc::core::Task::reset_section_times() {
+  for (auto& section : section_times) {
+    section.second = 0.0;
+  }
+}
+
+ppc::core::Task::Section::Section(Task& task_, const char* name_)
+    : task(task_), name(name_), begin(std::chrono::steady_clock::now()) {}
+
+ppc::core::Task::Section::~Section() {
+  auto end = std::chrono::steady_clock::now();
+  auto duration = std::chrono::duration<double>(end - begin).count();
+  for (auto& section : task.section_times) {
+    if (section.first == name) {
+      section.second += duration;
+      return;
+    }
+  }
+  task.section_times.emplace_back(name, duration);
 }
 
-ppc::core::Task::~Task() { functions_order.clear(); }
+ppc::core::Task::~Task() = default;
@@ -0,0 +1,143 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "core/task_graph/include/task_graph.hpp"
+
+namespace {
+
+// Sum of all elements of all inputs, fails when the sum is negative
+class AddTask : public ppc::core::Task {
+ public:
+  explicit AddTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool validation() override {
+    internal_order_test();
+    return taskData->outputs_count.size() == 1 && taskData->outputs_count[0] == 1;
+  }
+
+  bool pre_processing() override {
+    internal_order_test();
+    sum = 0;
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    for (size_t i = 0; i < taskData->inputs.size(); i++) {
+      for (auto value : taskData->input<int>(i)) {
+        sum += value;
+      }
+    }
+    return sum >= 0;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    taskData->output<int>(0)[0] = sum;
+    return true;
+  }
+
+ private:
+  int sum = 0;
+};
+
+struct Node {
+  std::vector<int> out = std::vector<int>(1, 0);
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  std::shared_ptr<AddTask> task;
+
+  Node() {
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    task = std::make_shared<AddTask>(taskData);
+  }
+};
+
+}  // namespace
+
+TEST(task_graph_tests, check_diamond) {
+  std::vector<int> in(100, 1);
+  Node a;
+  Node b;
+  Node c;
+  Node d;
+  a.taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  a.taskData->inputs_count.emplace_back(in.size());
+
+  ppc::core::TaskGraph graph;
+  auto id_a = graph.add(a.task, "a");
+  auto id_b = graph.add(b.task, "b");
+  auto id_c = graph.add(c.task, "c");
+  auto id_d = graph.add(d.task, "d");
+  graph.connect(id_a, 0, id_b, 0);
+  graph.connect(id_a, 0, id_c, 0);
+  graph.connect(id_b, 0, id_d, 0);
+  graph.connect(id_c, 0, id_d, 1);
+
+  // buffers are passed without copying
+  EXPECT_EQ(b.taskData->inputs[0], a.taskData->outputs[0]);
+
+  ASSERT_TRUE(graph.run(4));
+  EXPECT_EQ(a.out[0], 100);
+  EXPECT_EQ(b.out[0], 100);
+  EXPECT_EQ(c.out[0], 100);
+  EXPECT_EQ(d.out[0], 200);
+
+  // graph can be run again
+  in[0] = 11;
+  ppc::core::ThreadPool pool(2);
+  ASSERT_TRUE(graph.run(pool));
+  EXPECT_EQ(d.out[0], 220);
+
+  auto path = graph.critical_path();
+  ASSERT_EQ(path.size(), 3u);
+  EXPECT_EQ(path.front(), id_a);
+  EXPECT_EQ(path.back(), id_d);
+  EXPECT_GT(graph.critical_path_sec(), 0.0);
+  const auto &timings = graph.get_timings();
+  EXPECT_GE(timings[id_d].start_sec, timings[id_a].start_sec + timings[id_a].duration_sec);
+
+  std::stringstream report;
+  graph.print_report(report);
+  EXPECT_NE(report.str().find("critical path"), std::string::npos);
+}
+
+TEST(task_graph_tests, check_failed_node_skips_downstream) {
+  std::vector<int> in(10, -1);
+  Node a;
+  Node b;
+  Node c;
+  a.taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  a.taskData->inputs_count.emplace_back(in.size());
+
+  ppc::core::TaskGraph graph;
+  auto id_a = graph.add(a.task, "a");
+  auto id_b = graph.add(b.task, "b");
+  auto id_c = graph.add(c.task, "c");
+  graph.connect(id_a, 0, id_b, 0);
+
+  EXPECT_FALSE(graph.run(2));
+  const auto &timings = graph.get_timings();
+  EXPECT_FALSE(timings[id_a].succeeded);
+  EXPECT_TRUE(timings[id_b].skipped);
+  EXPECT_TRUE(timings[id_c].succeeded);
+}
+
+TEST(task_graph_tests, check_cycle) {
+  Node a;
+  Node b;
+
+  ppc::core::TaskGraph graph;
+  auto id_a = graph.add(a.task, "a");
+  auto id_b = graph.add(b.task, "b");
+  graph.connect(id_a, 0, id_b, 0);
+  graph.connect(id_b, 0, id_a, 0);
+  EXPECT_THROW(static_cast<void>(graph.topological_order()), std::logic_error);
+  EXPECT_THROW(graph.run(1), std::logic_error);
+  EXPECT_THROW(graph.connect(id_a, 1, id_b, 0), std::out_of_range);
+  EXPECT_THROW(graph.depend(id_a, 5), std::out_of_range);
+}
@@ -0,0 +1,75 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
+#define MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace ppc::core {
+
+// Directed acyclic graph of tasks. Outputs of a task are passed to inputs of
+// downstream tasks by pointer without copying, every task runs its whole
+// pipeline after all its upstream tasks finished, independent tasks run in
+// parallel on a thread pool. Tasks downstream of a failed task are skipped.
+class TaskGraph {
+ public:
+  using NodeId = size_t;
+
+  struct NodeTiming {
+    std::string name;
+    // start and duration of pipeline relative to the start of graph
+    double start_sec = 0.0;
+    double duration_sec = 0.0;
+    bool succeeded = false;
+    bool skipped = false;
+  };
+
+  NodeId add(std::shared_ptr<Task> task, std::string name);
+  // Use output out_index of from as input in_index of to (count and
+  // description of the buffer are taken from the output)
+  void connect(NodeId from, size_t out_index, NodeId to, size_t in_index);
+  // Run to after from without passing data
+  void depend(NodeId from, NodeId to);
+
+  // Nodes in order of dependencies, throws std::logic_error if the graph
+  // has a cycle
+  [[nodiscard]] std::vector<NodeId> topological_order() const;
+
+  // Run all tasks, true if all pipelines succeeded. Exception of a task is
+  // rethrown after all other tasks are finished or skipped.
+  bool run(ThreadPool& pool);
+  bool run(size_t num_threads = 0);
+
+  // Results of the last run
+  [[nodiscard]] const std::vector<NodeTiming>& get_timings() const { return timings; }
+  // Chain of dependent nodes with the longest total duration, it bounds the
+  // end-to-end latency of the graph
+  [[nodiscard]] std::vector<NodeId> critical_path() const;
+  [[nodiscard]] double critical_path_sec() const;
+  void print_report(std::ostream& out) const;
+
+ private:
+  struct Node {
+    std::shared_ptr<Task> task;
+    std::vector<NodeId> successors;
+    std::vector<NodeId> predecessors;
+  };
+  struct RunState;
+
+  void check_node(NodeId id) const;
+  void run_node(NodeId id, const std::shared_ptr<RunState>& state, ThreadPool& pool);
+
+  std::vector<Node> nodes;
+  std::vector<NodeTiming> timings;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_TASK_GRAPH_HPP_
@@ -0,0 +1,200 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/task_graph/include/task_graph.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <iomanip>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+struct ppc::core::TaskGraph::RunState {
+  explicit RunState(size_t num_nodes) : remaining(num_nodes), failed(num_nodes) {}
+
+  std::vector<std::atomic<size_t>> remaining;
+  std::vector<std::atomic<bool>> failed;
+  std::atomic<size_t> finished = 0;
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+  std::promise<void> done;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+};
+
+ppc::core::TaskGraph::NodeId ppc::core::TaskGraph::add(std::shared_ptr<Task> task, std::string name) {
+  if (!task) {
+    throw std::invalid_argument("Task of graph node is null");
+  }
+  nodes.push_back({std::move(task), {}, {}});
+  NodeTiming timing;
+  timing.name = std::move(name);
+  timings.push_back(std::move(timing));
+  return nodes.size() - 1;
+}
+
+void ppc::core::TaskGraph::connect(NodeId from, size_t out_index, NodeId to, size_t in_index) {
+  check_node(from);
+  check_node(to);
+  auto& out_data = *nodes[from].task->get_data();
+  auto& in_data = *nodes[to].task->get_data();
+  if (out_index >= out_data.outputs.size() || out_index >= out_data.outputs_count.size()) {
+    throw std::out_of_range("Output " + std::to_string(out_index) + " of node " + timings[from].name +
+                            " doesn't exist");
+  }
+
+  if (in_data.inputs.size() <= in_index) in_data.inputs.resize(in_index + 1, nullptr);
+  if (in_data.inputs_count.size() <= in_index) in_data.inputs_count.resize(in_index + 1, 0);
+  in_data.inputs[in_index] = out_data.outputs[out_index];
+  in_data.inputs_count[in_index] = out_data.outputs_count[out_index];
+  if (const auto* desc = out_data.output_desc(out_index)) {
+    if (in_data.inputs_desc.size() <= in_index) in_data.inputs_desc.resize(in_index + 1);
+    in_data.inputs_desc[in_index] = *desc;
+  }
+  depend(from, to);
+}
+
+void ppc::core::TaskGraph::depend(NodeId from, NodeId to) {
+  check_node(from);
+  check_node(to);
+  auto& successors = nodes[from].successors;
+  if (std::find(successors.begin(), successors.end(), to) != successors.end()) return;
+  successors.push_back(to);
+  nodes[to].predecessors.push_back(from);
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::topological_order() const {
+  std::vector<size_t> remaining(nodes.size());
+  std::vector<NodeId> order;
+  order.reserve(nodes.size());
+  for (NodeId id = 0; id < nodes.size(); id++) {
+    remaining[id] = nodes[id].predecessors.size();
+    if (remaining[id] == 0) order.push_back(id);
+  }
+  for (size_t i = 0; i < order.size(); i++) {
+    for (auto successor : nodes[order[i]].successors) {
+      if (--remaining[successor] == 0) order.push_back(successor);
+    }
+  }
+  if (order.size() != nodes.size()) {
+    throw std::logic_error("Task graph has a cycle");
+  }
+  return order;
+}
+
+bool ppc::core::TaskGraph::run(ThreadPool& pool) {
+  auto order = topological_order();
+  if (nodes.empty()) return true;
+
+  auto state = std::make_shared<RunState>(nodes.size());
+  for (NodeId id = 0; id < nodes.size(); id++) {
+    state->remaining[id] = nodes[id].predecessors.size();
+    timings[id].start_sec = timings[id].duration_sec = 0.0;
+    timings[id].succeeded = timings[id].skipped = false;
+  }
+  auto done = state->done.get_future();
+  for (auto id : order) {
+    if (!nodes[id].predecessors.empty()) break;
+    pool.post([this, id, state, &pool] { run_node(id, state, pool); });
+  }
+  pool.wait(done);
+
+  if (state->error) std::rethrow_exception(state->error);
+  return std::all_of(timings.begin(), timings.end(), [](const NodeTiming& timing) { return timing.succeeded; });
+}
+
+bool ppc::core::TaskGraph::run(size_t num_threads) {
+  ThreadPool pool(num_threads);
+  return run(pool);
+}
+
+void ppc::core::TaskGraph::run_node(NodeId id, const std::shared_ptr<RunState>& state, ThreadPool& pool) {
+  auto& node = nodes[id];
+  auto& timing = timings[id];
+  bool skip = std::any_of(node.predecessors.begin(), node.predecessors.end(),
+                          [&state](NodeId predecessor) { return state->failed[predecessor].load(); });
+
+  if (skip) {
+    timing.skipped = true;
+  } else {
+    auto start = std::chrono::steady_clock::now();
+    try {
+      auto& task = *node.task;
+      timing.succeeded = task.validation() && task.pre_processing() && task.run() && task.post_processing();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state->error_mutex);
+      if (!state->error) state->error = std::current_exception();
+    }
+    auto end = std::chrono::steady_clock::now();
+    timing.start_sec = std::chrono::duration<double>(start - state->begin).count();
+    timing.duration_sec = std::chrono::duration<double>(end - start).count();
+  }
+  state->failed[id] = !timing.succeeded;
+
+  for (auto successor : node.successors) {
+    if (--state->remaining[successor] == 0) {
+      pool.post([this, successor, state, &pool] { run_node(successor, state, pool); });
+    }
+  }
+  // nothing of the graph can be touched after the last node is finished
+  if (++state->finished == nodes.size()) state->done.set_value();
+}
+
+std::vector<ppc::core::TaskGraph::NodeId> ppc::core::TaskGraph::critical_path() const {
+  auto order = topological_order();
+  std::vector<double> finish(nodes.size(), 0.0);
+  std::vector<NodeId> previous(nodes.size(), nodes.size());
+  for (auto id : order) {
+    double start = 0.0;
+    for (auto predecessor : nodes[id].predecessors) {
+      if (finish[predecessor] >= start) {
+        start = finish[predecessor];
+        previous[id] = predecessor;
+      }
+    }
+    finish[id] = start + timings[id].duration_sec;
+  }
+  if (nodes.empty()) return {};
+
+  std::vector<NodeId> path;
+  auto last = static_cast<NodeId>(std::max_element(finish.begin(), finish.end()) - finish.begin());
+  for (auto id = last; id != nodes.size(); id = previous[id]) {
+    path.push_back(id);
+  }
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+double ppc::core::TaskGraph::critical_path_sec() const {
+  double res = 0.0;
+  for (auto id : critical_path()) {
+    res += timings[id].duration_sec;
+  }
+  return res;
+}
+
+void ppc::core::TaskGraph::print_report(std::ostream& out) const {
+  auto path = critical_path();
+  out << std::fixed << std::setprecision(6);
+  for (NodeId id = 0; id < nodes.size(); id++) {
+    const auto& timing = timings[id];
+    bool is_critical = std::find(path.begin(), path.end(), id) != path.end();
+    out << (is_critical ? "* " : "  ") << timing.name << ": start " << timing.start_sec << " s, duration "
+        << timing.duration_sec << " s";
+    if (timing.skipped) {
+      out << " (skipped)";
+    } else if (!timing.succeeded) {
+      out << " (failed)";
+    }
+    out << std::endl;
+  }
+  out << "critical path: " << critical_path_sec() << " s" << std::endl;
+}
+
+void ppc::core::TaskGraph::check_node(NodeId id) const {
+  if (id >= nodes.size()) {
+    throw std::out_of_range("Node " + std::to_string(id) + " of task graph doesn't exist");
+  }
+}
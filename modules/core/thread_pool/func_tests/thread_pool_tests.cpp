@@ -0,0 +1,142 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+TEST(thread_pool_tests, check_submit) {
+  ppc::core::ThreadPool pool(4);
+  ASSERT_EQ(pool.size(), 4u);
+
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; i++) {
+    futures.push_back(pool.submit([i] { return i * i; }));
+  }
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(futures[i].get(), i * i);
+  }
+}
+
+TEST(thread_pool_tests, check_pending_jobs_are_finished) {
+  std::atomic<int> counter = 0;
+  {
+    ppc::core::ThreadPool pool(2);
+    for (int i = 0; i < 1000; i++) {
+      pool.post([&counter] { counter++; });
+    }
+  }
+  EXPECT_EQ(counter, 1000);
+}
+
+TEST(thread_pool_tests, check_nested_wait) {
+  // a single worker waits for jobs posted by itself
+  ppc::core::ThreadPool pool(1);
+  auto outer = pool.submit([&pool] {
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 10; i++) {
+      futures.push_back(pool.submit([i] { return i; }));
+    }
+    int sum = 0;
+    for (auto& future : futures) {
+      pool.wait(future);
+      sum += future.get();
+    }
+    return sum;
+  });
+  EXPECT_EQ(outer.get(), 45);
+}
+
+TEST(thread_pool_tests, check_exception) {
+  ppc::core::ThreadPool pool(2);
+  auto future = pool.submit([]() -> int { throw std::runtime_error("error"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(thread_pool_tests, check_current_worker) {
+  ppc::core::ThreadPool pool(3);
+  EXPECT_EQ(pool.current_worker(), pool.size());
+  auto worker = pool.submit([&pool] { return pool.current_worker(); }).get();
+  EXPECT_LT(worker, pool.size());
+}
+
+TEST(thread_pool_tests, check_parallel_for) {
+  ppc::core::ThreadPool pool(4);
+  std::vector<int> data(10007, 0);
+  pool.parallel_for(0, data.size(), [&](size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+      data[i]++;
+    }
+  });
+  EXPECT_EQ(std::count(data.begin(), data.end(), 1), static_cast<std::ptrdiff_t>(data.size()));
+
+  // grain bigger than range gives a single chunk
+  std::atomic<int> num_chunks = 0;
+  pool.parallel_for(
+      5, 10,
+      [&](size_t first, size_t last) {
+        num_chunks++;
+        EXPECT_EQ(first, 5u);
+        EXPECT_EQ(last, 10u);
+      },
+      100);
+  EXPECT_EQ(num_chunks, 1);
+}
+
+TEST(thread_pool_tests, check_parallel_reduce) {
+  ppc::core::ThreadPool pool(3);
+  std::vector<int64_t> data(12345);
+  std::iota(data.begin(), data.end(), 1);
+  auto sum = pool.parallel_reduce(
+      0, data.size(), int64_t{0},
+      [&](size_t first, size_t last) { return std::accumulate(data.begin() + first, data.begin() + last, int64_t{0}); },
+      std::plus<>());
+  EXPECT_EQ(sum, int64_t{12345} * 12346 / 2);
+
+  // chunks are combined in order
+  auto str = pool.parallel_reduce(
+      0, 26, std::string(),
+      [](size_t first, size_t last) {
+        std::string res;
+        for (auto i = first; i < last; i++) res += static_cast<char>('a' + i);
+        return res;
+      },
+      [](std::string lhs, const std::string &rhs) { return lhs + rhs; });
+  EXPECT_EQ(str, "abcdefghijklmnopqrstuvwxyz");
+}
+
+TEST(thread_pool_tests, check_nested_parallel_for_and_exception) {
+  ppc::core::ThreadPool pool(2);
+  std::atomic<int> counter = 0;
+  pool.parallel_for(0, 8, [&](size_t first, size_t last) {
+    for (auto i = first; i < last; i++) {
+      pool.parallel_for(0, 100, [&](size_t inner_first, size_t inner_last) {
+        counter += static_cast<int>(inner_last - inner_first);
+      });
+    }
+  });
+  EXPECT_EQ(counter, 800);
+
+  auto throwing_body = [](size_t first, size_t) {
+    if (first == 0) throw std::runtime_error("error");
+  };
+  EXPECT_THROW(pool.parallel_for(0, 100, throwing_body), std::runtime_error);
+}
+
+TEST(thread_pool_tests, check_affinity_and_instance) {
+  for (auto affinity : {ppc::core::Affinity::COMPACT, ppc::core::Affinity::SCATTER}) {
+    ppc::core::ThreadPool pool(2, affinity);
+    EXPECT_EQ(pool.submit([] { return 1; }).get(), 1);
+  }
+  auto &pool = ppc::core::ThreadPool::instance();
+  EXPECT_EQ(&pool, &ppc::core::ThreadPool::instance());
+  EXPECT_EQ(pool.size(), ppc::core::ThreadPool::default_num_threads());
+}
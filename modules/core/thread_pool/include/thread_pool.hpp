@@ -0,0 +1,136 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+#define MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// Binding of workers to CPUs available to the process (Linux only):
+// COMPACT - worker i to i-th CPU, SCATTER - workers evenly over all CPUs
+enum class Affinity : uint8_t { NONE, COMPACT, SCATTER };
+
+// Persistent pool of worker threads with a deque of jobs per worker. Workers
+// take their own jobs from the back and steal jobs of other workers from the
+// front. Jobs posted from a worker go to its own deque, other jobs are spread
+// over workers round-robin.
+class ThreadPool {
+ public:
+  // num_threads == 0 - default_num_threads()
+  explicit ThreadPool(size_t num_threads = 0, Affinity affinity = Affinity::NONE);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  // Pending jobs are finished before the workers are joined
+  ~ThreadPool();
+
+  [[nodiscard]] size_t size() const { return workers.size(); }
+
+  // Run job on the pool without waiting for it
+  void post(std::function<void()> job);
+
+  // Run function on the pool, exceptions are passed through the future
+  template <class F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& func) {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto job = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+    auto res = job->get_future();
+    post([job] { (*job)(); });
+    return res;
+  }
+
+  // Run one pending job in the calling thread, false if there is no one
+  bool run_pending();
+
+  // Wait for the future running pending jobs meanwhile, so a job of the pool
+  // can wait for other jobs without deadlock
+  template <class T>
+  void wait(const std::future<T>& future) {
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      if (!run_pending()) std::this_thread::yield();
+    }
+  }
+
+  // Call body(first, last) for chunks of [begin, end) in parallel, chunks are
+  // not shorter than grain (except the last one). The calling thread takes
+  // part in the work, exception of body is rethrown after all chunks end.
+  template <class F>
+  void parallel_for(size_t begin, size_t end, F&& body, size_t grain = 1) {
+    if (begin >= end) return;
+    auto num_chunks = count_chunks(end - begin, grain);
+    run_chunks(num_chunks, [&](size_t chunk) {
+      auto [first, last] = chunk_range(begin, end, num_chunks, chunk);
+      body(first, last);
+    });
+  }
+
+  // Reduce [begin, end): map(first, last) gives value of a chunk, values of
+  // chunks are combined in order of chunks with reduce(lhs, rhs) starting from
+  // identity, so the result doesn't depend on scheduling
+  template <class T, class Map, class Reduce>
+  T parallel_reduce(size_t begin, size_t end, T identity, Map&& map, Reduce&& reduce, size_t grain = 1) {
+    if (begin >= end) return identity;
+    auto num_chunks = count_chunks(end - begin, grain);
+    std::vector<T> partial(num_chunks, identity);
+    run_chunks(num_chunks, [&](size_t chunk) {
+      auto [first, last] = chunk_range(begin, end, num_chunks, chunk);
+      partial[chunk] = map(first, last);
+    });
+    T res = std::move(identity);
+    for (auto& value : partial) {
+      res = reduce(std::move(res), std::move(value));
+    }
+    return res;
+  }
+
+  // Index of the calling worker of this pool or size() for other threads
+  [[nodiscard]] size_t current_worker() const;
+
+  // Pool shared by all tasks of the process, it has default_num_threads()
+  // workers with affinity from PPC_THREAD_AFFINITY (none, compact, scatter)
+  static ThreadPool& instance();
+
+  // PPC_NUM_THREADS or count of hardware threads
+  static size_t default_num_threads();
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> jobs;
+  };
+
+  bool pop(size_t index, std::function<void()>& job);
+  void worker_loop(size_t index);
+  void set_affinity(Affinity affinity);
+
+  // Chunks are run by workers and the calling thread, the call returns when
+  // all chunks are finished
+  void run_chunks(size_t num_chunks, const std::function<void(size_t)>& chunk);
+  [[nodiscard]] size_t count_chunks(size_t count, size_t grain) const;
+  static std::pair<size_t, size_t> chunk_range(size_t begin, size_t end, size_t num_chunks, size_t chunk);
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<size_t> next_queue = 0;
+  std::atomic<size_t> pending = 0;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool stop = false;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_THREAD_POOL_HPP_
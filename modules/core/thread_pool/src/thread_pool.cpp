@@ -0,0 +1,211 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+thread_local const ppc::core::ThreadPool* current_pool = nullptr;
+thread_local size_t current_index = 0;
+
+ppc::core::Affinity affinity_from_env() {
+  if (const char* value = std::getenv("PPC_THREAD_AFFINITY")) {
+    std::string affinity(value);
+    if (affinity == "compact") return ppc::core::Affinity::COMPACT;
+    if (affinity == "scatter") return ppc::core::Affinity::SCATTER;
+  }
+  return ppc::core::Affinity::NONE;
+}
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(size_t num_threads, Affinity affinity) {
+  if (num_threads == 0) num_threads = default_num_threads();
+  for (size_t i = 0; i < num_threads; i++) {
+    queues.push_back(std::make_unique<Queue>());
+  }
+  workers.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; i++) {
+    workers.emplace_back([this, i] { worker_loop(i); });
+  }
+  set_affinity(affinity);
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  cv.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void ppc::core::ThreadPool::post(std::function<void()> job) {
+  auto index = current_worker();
+  if (index == size()) index = next_queue++ % size();
+  {
+    // count the job before it can be taken, so pending never goes below zero
+    std::lock_guard<std::mutex> lock(mutex);
+    pending++;
+  }
+  {
+    std::lock_guard<std::mutex> lock(queues[index]->mutex);
+    queues[index]->jobs.push_back(std::move(job));
+  }
+  cv.notify_one();
+}
+
+bool ppc::core::ThreadPool::run_pending() {
+  std::function<void()> job;
+  if (!pop(current_worker(), job)) return false;
+  job();
+  return true;
+}
+
+size_t ppc::core::ThreadPool::current_worker() const { return current_pool == this ? current_index : size(); }
+
+ppc::core::ThreadPool& ppc::core::ThreadPool::instance() {
+  static ThreadPool pool(0, affinity_from_env());
+  return pool;
+}
+
+size_t ppc::core::ThreadPool::default_num_threads() {
+  if (const char* value = std::getenv("PPC_NUM_THREADS")) {
+    auto count = std::strtoull(value, nullptr, 10);
+    if (count > 0) return count;
+  }
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+bool ppc::core::ThreadPool::pop(size_t index, std::function<void()>& job) {
+  const auto num_queues = queues.size();
+  if (index < num_queues) {
+    auto& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.back());
+      queue.jobs.pop_back();
+      pending--;
+      return true;
+    }
+  }
+  // steal the oldest job of other workers
+  for (size_t i = 1; i <= num_queues; i++) {
+    auto& queue = *queues[(index + i) % num_queues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.jobs.empty()) {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+      pending--;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ppc::core::ThreadPool::worker_loop(size_t index) {
+  current_pool = this;
+  current_index = index;
+  std::function<void()> job;
+  while (true) {
+    if (pop(index, job)) {
+      job();
+      job = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return stop || pending > 0; });
+    if (stop && pending == 0) break;
+  }
+  current_pool = nullptr;
+}
+
+void ppc::core::ThreadPool::set_affinity(Affinity affinity) {
+#if defined(__linux__)
+  if (affinity == Affinity::NONE) return;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+  }
+  if (cpus.empty()) return;
+
+  for (size_t i = 0; i < workers.size(); i++) {
+    auto index = i % cpus.size();
+    if (affinity == Affinity::SCATTER && workers.size() < cpus.size()) {
+      index = i * cpus.size() / workers.size();
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpus[index], &cpu_set);
+    pthread_setaffinity_np(workers[i].native_handle(), sizeof(cpu_set), &cpu_set);
+  }
+#else
+  (void)affinity;
+#endif
+}
+
+void ppc::core::ThreadPool::run_chunks(size_t num_chunks, const std::function<void(size_t)>& chunk) {
+  if (num_chunks == 1) {
+    chunk(0);
+    return;
+  }
+
+  // chunks are claimed by index, so the calling thread finishes chunks that
+  // busy workers didn't take
+  std::atomic<size_t> next = 0;
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto work = [&] {
+    for (auto i = next++; i < num_chunks; i = next++) {
+      try {
+        chunk(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) error = std::current_exception();
+      }
+    }
+  };
+
+  auto num_helpers = std::min(size(), num_chunks - 1);
+  std::atomic<size_t> active_helpers = num_helpers;
+  for (size_t i = 0; i < num_helpers; i++) {
+    post([&] {
+      work();
+      active_helpers--;
+    });
+  }
+  work();
+  // helpers reference this frame, so all of them have to end
+  while (active_helpers != 0) {
+    if (!run_pending()) std::this_thread::yield();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+size_t ppc::core::ThreadPool::count_chunks(size_t count, size_t grain) const {
+  // a few chunks per thread for balance of load
+  auto max_chunks = (size() + 1) * 4;
+  return std::clamp<size_t>(count / std::max<size_t>(grain, 1), 1, max_chunks);
+}
+
+std::pair<size_t, size_t> ppc::core::ThreadPool::chunk_range(size_t begin, size_t end, size_t num_chunks,
+                                                             size_t chunk) {
+  auto count = end - begin;
+  auto base = count / num_chunks;
+  auto remainder = count % num_chunks;
+  auto first = begin + chunk * base + std::min(chunk, remainder);
+  return {first, first + base + (chunk < remainder ? 1 : 0)};
+}
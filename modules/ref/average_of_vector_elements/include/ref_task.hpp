@@ -6,10 +6,11 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/simd_kernels/include/simd_kernels.hpp"
 
 namespace ppc {
 namespace reference {
@@ -20,12 +21,8 @@ class AverageOfVectorElements : public ppc::core::Task {
   explicit AverageOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input
+    input_ = taskData->input<InType>(0);
     // Init value for output
     average = 0.0;
     return true;
@@ -39,7 +36,7 @@ class AverageOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    average = static_cast<OutType>(std::accumulate(input_.begin(), input_.end(), 0.0));
+    average = static_cast<OutType>(simd::sum(input_));
     average /= static_cast<OutType>(taskData->inputs_count[0]);
     return true;
   }
@@ -51,7 +48,7 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InType> input_;
+  std::span<const InType> input_;
   OutType average;
 };
 
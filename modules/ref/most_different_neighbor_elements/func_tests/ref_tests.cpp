@@ -40,6 +40,55 @@ TEST(most_different_neighbor_elements, check_int32_t) {
   EXPECT_EQ(out_index[1], 235ull);
 }
 
+TEST(most_different_neighbor_elements, check_rebind) {
+  // Create data
+  std::vector<int32_t> in(1256, 1);
+  std::vector<int32_t> other_in(100, 1);
+  std::vector<int32_t> out(2, 0);
+  std::vector<uint64_t> out_index(2, 0);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = 2 * i;
+  }
+  in[234] = 0;
+  in[235] = 4000;
+  other_in[10] = -50;
+
+  // Create TaskData
+  auto makeTaskData = [&](std::vector<int32_t>& input) {
+    auto taskData = std::make_shared<ppc::core::TaskData>();
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t*>(input.data()));
+    taskData->inputs_count.emplace_back(input.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_index.data()));
+    taskData->outputs_count.emplace_back(out_index.size());
+    return taskData;
+  };
+
+  // Create Task and reuse it for other data
+  ppc::reference::MostDifferentNeighborElements<int32_t, uint64_t> testTask(makeTaskData(in));
+  testTask.prepare(in.size());
+  for (int i = 0; i < 2; i++) {
+    testTask.rebind(makeTaskData(in));
+    ASSERT_TRUE(testTask.validation());
+    testTask.pre_processing();
+    testTask.run();
+    testTask.post_processing();
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 4000);
+    EXPECT_EQ(out_index[0], 234ull);
+
+    testTask.rebind(makeTaskData(other_in));
+    ASSERT_TRUE(testTask.validation());
+    testTask.pre_processing();
+    testTask.run();
+    testTask.post_processing();
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], -50);
+    EXPECT_EQ(out_index[0], 9ull);
+  }
+}
+
 TEST(most_different_neighbor_elements, check_validate_func) {
   // Create data
   std::vector<int32_t> in(125, 1);
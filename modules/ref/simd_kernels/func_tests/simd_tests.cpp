@@ -0,0 +1,105 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "ref/simd_kernels/include/simd_kernels.hpp"
+
+namespace {
+
+namespace simd = ppc::reference::simd;
+
+template <class T>
+std::vector<T> getRandomVector(size_t sz, int seed) {
+  std::mt19937 gen(seed);
+  std::vector<T> vec(sz);
+  for (auto& value : vec) {
+    value = static_cast<T>(static_cast<int>(gen() % 200) - 100);
+  }
+  return vec;
+}
+
+template <class Kernels, class T>
+void check_kernels(const std::vector<T>& a, const std::vector<T>& b) {
+  using Scalar = simd::Kernels<simd::Isa::SCALAR>;
+  const auto n = a.size();
+  EXPECT_EQ(Kernels::sum(a.data(), n), Scalar::sum(a.data(), n));
+  EXPECT_NEAR(Kernels::dot(a.data(), b.data(), n), Scalar::dot(a.data(), b.data(), n), 1e-6);
+  EXPECT_EQ(Kernels::template neighbor_diff_index<true>(a.data(), n),
+            Scalar::neighbor_diff_index<true>(a.data(), n));
+  EXPECT_EQ(Kernels::template neighbor_diff_index<false>(a.data(), n),
+            Scalar::neighbor_diff_index<false>(a.data(), n));
+  EXPECT_EQ(Kernels::count_sign_alternations(a.data(), n), Scalar::count_sign_alternations(a.data(), n));
+  EXPECT_EQ(Kernels::count_order_violations(a.data(), n), Scalar::count_order_violations(a.data(), n));
+}
+
+template <class Kernels>
+void check_variant() {
+  // sizes around widths of registers check tails of loops
+  for (size_t n : {0, 1, 2, 3, 15, 16, 17, 63, 64, 65, 1000, 40001}) {
+    check_kernels<Kernels>(getRandomVector<int8_t>(n, 1), getRandomVector<int8_t>(n, 2));
+    check_kernels<Kernels>(getRandomVector<uint8_t>(n, 3), getRandomVector<uint8_t>(n, 4));
+    check_kernels<Kernels>(getRandomVector<int32_t>(n, 5), getRandomVector<int32_t>(n, 6));
+    check_kernels<Kernels>(getRandomVector<int64_t>(n, 7), getRandomVector<int64_t>(n, 8));
+    check_kernels<Kernels>(getRandomVector<float>(n, 9), getRandomVector<float>(n, 10));
+    check_kernels<Kernels>(getRandomVector<double>(n, 11), getRandomVector<double>(n, 12));
+  }
+}
+
+}  // namespace
+
+TEST(simd_kernels, check_scalar_kernels) {
+  std::vector<int32_t> in{1, -2, 3, 3, -100, 2147483647, -2147483647 - 1, 0};
+  using Scalar = simd::Kernels<simd::Isa::SCALAR>;
+  EXPECT_EQ(Scalar::neighbor_diff_index<true>(in.data(), in.size()), 5u);
+  EXPECT_EQ(Scalar::neighbor_diff_index<false>(in.data(), in.size()), 2u);
+  EXPECT_EQ(Scalar::count_sign_alternations(in.data(), in.size()), 5u);
+  EXPECT_EQ(Scalar::count_order_violations(in.data(), in.size()), 3u);
+}
+
+#if PPC_DISPATCH_X86
+TEST(simd_kernels, check_sse2) { check_variant<simd::Kernels<simd::Isa::SSE2>>(); }
+
+TEST(simd_kernels, check_avx2) {
+  if (ppc::core::cpu_isa() < simd::Isa::AVX2) GTEST_SKIP() << "AVX2 is not supported";
+  check_variant<simd::Kernels<simd::Isa::AVX2>>();
+}
+
+TEST(simd_kernels, check_avx512) {
+  if (ppc::core::cpu_isa() < simd::Isa::AVX512) GTEST_SKIP() << "AVX-512 is not supported";
+  check_variant<simd::Kernels<simd::Isa::AVX512>>();
+}
+#endif
+
+TEST(simd_kernels, check_first_index_of_equal_pairs) {
+  // all pairs differ by 1, the first one is expected like std::max_element
+  std::vector<int8_t> in(1000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = static_cast<int8_t>(i % 2);
+  }
+  EXPECT_EQ(simd::max_neighbor_diff_index(std::span<const int8_t>(in)), 0u);
+  in[777] = 100;
+  EXPECT_EQ(simd::max_neighbor_diff_index(std::span<const int8_t>(in)), 776u);
+  EXPECT_EQ(simd::count_order_violations(std::span<const int8_t>(in)), 499u);
+}
+
+TEST(simd_kernels, check_narrow_counters) {
+  // more alternations than int8_t lanes can count
+  std::vector<int8_t> in(100000);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = i % 2 == 0 ? 1 : -1;
+  }
+  EXPECT_EQ(simd::count_sign_alternations(std::span<const int8_t>(in)), in.size() - 1);
+}
+
+TEST(simd_kernels, check_sum_is_widened) {
+  std::vector<int32_t> in(1001, 2147483647);
+  EXPECT_EQ(simd::sum(std::span<const int32_t>(in)), int64_t{2147483647} * 1001);
+  std::vector<uint8_t> bytes(1001, 255);
+  EXPECT_EQ(simd::sum(std::span<const uint8_t>(bytes)), uint64_t{255} * 1001);
+  std::vector<float> values(1000001, 0.1f);
+  EXPECT_NEAR(simd::sum(std::span<const float>(values)), 1000001 * static_cast<double>(0.1f), 1e-6);
+}
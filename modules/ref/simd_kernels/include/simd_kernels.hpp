@@ -0,0 +1,455 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_REFERENCE_SIMD_KERNELS_HPP_
+#define MODULES_REFERENCE_SIMD_KERNELS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "core/dispatch/include/dispatch.hpp"
+#include "core/parallel/include/accumulator.hpp"
+
+namespace ppc {
+namespace reference {
+namespace simd {
+
+using ppc::core::accumulator_t;
+using ppc::core::Isa;
+
+// Types with vector kernels, others always use scalar kernels
+template <class T>
+constexpr bool kVectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8;
+
+template <class T>
+constexpr Isa kMaxIsa = kVectorizable<T> ? Isa::AVX512 : Isa::SCALAR;
+
+// |x - y| is computed in unsigned type for integers, so it doesn't overflow
+template <class T>
+using DiffType = typename std::conditional_t<std::is_integral_v<T>, std::make_unsigned<T>, std::type_identity<T>>::type;
+
+template <class T>
+DiffType<T> abs_diff(T x, T y) {
+  if constexpr (std::is_integral_v<T>) {
+    using U = DiffType<T>;
+    return x > y ? static_cast<U>(static_cast<U>(x) - static_cast<U>(y))
+                 : static_cast<U>(static_cast<U>(y) - static_cast<U>(x));
+  } else {
+    return x > y ? x - y : y - x;
+  }
+}
+
+template <class T>
+bool is_sign_alternation(T x, T y) {
+  return (x < 0 && y > 0) || (x > 0 && y < 0);
+}
+
+// Kernels of a variant. Neighbour kernels look at pairs (i, i + 1) and return
+// the first index of the best pair, 0 for less than two elements.
+template <Isa I>
+struct Kernels;
+
+template <>
+struct Kernels<Isa::SCALAR> {
+  // Sums are computed in accumulator_t, so they don't overflow for narrow types
+  template <class T>
+  static accumulator_t<T> sum(const T* data, size_t count) {
+    return ppc::core::accumulate(std::span<const T>(data, count));
+  }
+
+  template <class T>
+  static double dot(const T* a, const T* b, size_t count) {
+    double res = 0.0;
+    for (size_t i = 0; i < count; i++) {
+      res += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+    }
+    return res;
+  }
+
+  // Pair with max (IsMax) or min |data[i] - data[i + 1]|
+  template <bool IsMax, class T>
+  static size_t neighbor_diff_index(const T* data, size_t count) {
+    size_t res = 0;
+    if (count < 2) return res;
+    auto best = abs_diff(data[0], data[1]);
+    for (size_t i = 1; i + 1 < count; i++) {
+      auto diff = abs_diff(data[i], data[i + 1]);
+      if (IsMax ? diff > best : diff < best) {
+        best = diff;
+        res = i;
+      }
+    }
+    return res;
+  }
+
+  template <class T>
+  static size_t count_sign_alternations(const T* data, size_t count) {
+    size_t res = 0;
+    for (size_t i = 0; i + 1 < count; i++) {
+      res += is_sign_alternation(data[i], data[i + 1]) ? 1 : 0;
+    }
+    return res;
+  }
+
+  template <class T>
+  static size_t count_order_violations(const T* data, size_t count) {
+    size_t res = 0;
+    for (size_t i = 0; i + 1 < count; i++) {
+      res += data[i] > data[i + 1] ? 1 : 0;
+    }
+    return res;
+  }
+};
+
+#if PPC_DISPATCH_X86
+
+// Generic vector kernels, Bytes is the width of registers. They are always
+// inlined into entry points of Kernels<Isa>, so the instructions come from
+// the target of the entry point.
+namespace vec {
+
+template <class T, size_t Bytes>
+struct Vector {
+  typedef T type __attribute__((vector_size(Bytes)));
+  // Same vector at an address aligned to elements only
+  typedef T unaligned __attribute__((vector_size(Bytes), aligned(alignof(T)), may_alias));
+};
+
+template <class T, size_t Bytes>
+using VectorType = typename Vector<T, Bytes>::type;
+
+template <size_t Size>
+using IntOfSize = std::conditional_t<
+    Size == 1, int8_t, std::conditional_t<Size == 2, int16_t, std::conditional_t<Size == 4, int32_t, int64_t>>>;
+
+template <size_t Bytes, class T>
+[[gnu::always_inline]] inline const typename Vector<T, Bytes>::unaligned& load(const T* ptr) {
+  return *reinterpret_cast<const typename Vector<T, Bytes>::unaligned*>(ptr);
+}
+
+template <class M>
+[[gnu::always_inline]] inline bool any_lane(const M& mask) {
+  uint64_t words[sizeof(M) / sizeof(uint64_t)];
+  std::memcpy(words, &mask, sizeof(M));
+  uint64_t res = 0;
+  for (auto word : words) {
+    res |= word;
+  }
+  return res != 0;
+}
+
+// Elements are widened to lanes of accumulator_t before adding
+template <class T, size_t Bytes>
+[[gnu::always_inline]] inline accumulator_t<T> sum(const T* data, size_t count) {
+  using A = accumulator_t<T>;
+  using VA = VectorType<A, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(A);
+  constexpr size_t kBytes = kLanes * sizeof(T);
+  VA acc0{};
+  VA acc1{};
+  size_t i = 0;
+  for (; i + 2 * kLanes <= count; i += 2 * kLanes) {
+    acc0 += __builtin_convertvector(load<kBytes>(data + i), VA);
+    acc1 += __builtin_convertvector(load<kBytes>(data + i + kLanes), VA);
+  }
+  for (; i + kLanes <= count; i += kLanes) {
+    acc0 += __builtin_convertvector(load<kBytes>(data + i), VA);
+  }
+  acc0 += acc1;
+  A res = 0;
+  for (size_t lane = 0; lane < kLanes; lane++) {
+    res += acc0[lane];
+  }
+  for (; i < count; i++) {
+    res += static_cast<A>(data[i]);
+  }
+  return res;
+}
+
+template <class T, size_t Bytes>
+[[gnu::always_inline]] inline double dot(const T* a, const T* b, size_t count) {
+  using VD = VectorType<double, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(double);
+  constexpr size_t kBytes = kLanes * sizeof(T);
+  VD acc0{};
+  VD acc1{};
+  size_t i = 0;
+  for (; i + 2 * kLanes <= count; i += 2 * kLanes) {
+    acc0 += __builtin_convertvector(load<kBytes>(a + i), VD) * __builtin_convertvector(load<kBytes>(b + i), VD);
+    acc1 += __builtin_convertvector(load<kBytes>(a + i + kLanes), VD) *
+            __builtin_convertvector(load<kBytes>(b + i + kLanes), VD);
+  }
+  for (; i + kLanes <= count; i += kLanes) {
+    acc0 += __builtin_convertvector(load<kBytes>(a + i), VD) * __builtin_convertvector(load<kBytes>(b + i), VD);
+  }
+  acc0 += acc1;
+  double res = 0.0;
+  for (size_t lane = 0; lane < kLanes; lane++) {
+    res += acc0[lane];
+  }
+  for (; i < count; i++) {
+    res += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+  }
+  return res;
+}
+
+// res = |data[i] - data[i + 1]| for lanes i
+template <size_t Bytes, class T>
+[[gnu::always_inline]] inline void abs_diff(const T* data, VectorType<DiffType<T>, Bytes>& res) {
+  using VD = VectorType<DiffType<T>, Bytes>;
+  const auto& x = load<Bytes>(data);
+  const auto& y = load<Bytes>(data + 1);
+  if constexpr (std::is_integral_v<T>) {
+    res = x > y ? VD(x) - VD(y) : VD(y) - VD(x);
+  } else {
+    res = x > y ? x - y : y - x;
+  }
+}
+
+// Two passes: the best difference, then the first pair having it
+template <bool IsMax, class T, size_t Bytes>
+[[gnu::always_inline]] inline size_t neighbor_diff_index(const T* data, size_t count) {
+  using VD = VectorType<DiffType<T>, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  if (count < 2) return 0;
+
+  auto best = simd::abs_diff(data[0], data[1]);
+  VD best_vec = VD{} + best;
+  VD diff;
+  size_t i = 0;
+  for (; i + kLanes < count; i += kLanes) {
+    abs_diff<Bytes>(data + i, diff);
+    best_vec = (IsMax ? diff > best_vec : diff < best_vec) ? diff : best_vec;
+  }
+  for (size_t lane = 0; lane < kLanes; lane++) {
+    if (IsMax ? best_vec[lane] > best : best_vec[lane] < best) best = best_vec[lane];
+  }
+  for (auto j = i; j + 1 < count; j++) {
+    auto pair_diff = simd::abs_diff(data[j], data[j + 1]);
+    if (IsMax ? pair_diff > best : pair_diff < best) best = pair_diff;
+  }
+
+  best_vec = VD{} + best;
+  for (i = 0; i + kLanes < count; i += kLanes) {
+    abs_diff<Bytes>(data + i, diff);
+    auto found = diff == best_vec;
+    if (any_lane(found)) {
+      for (size_t lane = 0; lane < kLanes; lane++) {
+        if (found[lane]) return i + lane;
+      }
+    }
+  }
+  for (; i + 1 < count; i++) {
+    if (simd::abs_diff(data[i], data[i + 1]) == best) return i;
+  }
+  return 0;
+}
+
+// Predicates of pairs: pred(x, y) for scalars, pred(x, y, mask) for vectors
+struct SignAlternation {
+  template <class T>
+  bool operator()(T x, T y) const {
+    return is_sign_alternation(x, y);
+  }
+
+  template <class V, class M>
+  [[gnu::always_inline]] void operator()(const V& x, const V& y, M& mask) const {
+    V zero{};
+    mask = M(((x < zero) & (y > zero)) | ((x > zero) & (y < zero)));
+  }
+};
+
+struct OrderViolation {
+  template <class T>
+  bool operator()(T x, T y) const {
+    return x > y;
+  }
+
+  template <class V, class M>
+  [[gnu::always_inline]] void operator()(const V& x, const V& y, M& mask) const {
+    mask = M(x > y);
+  }
+};
+
+// Count of pairs matching pred. Lanes of counters are as narrow as elements,
+// so they are flushed before overflow.
+template <class T, size_t Bytes, class Pred>
+[[gnu::always_inline]] inline size_t count_pairs(const T* data, size_t count, Pred pred) {
+  using M = IntOfSize<sizeof(T)>;
+  using VM = VectorType<M, Bytes>;
+  constexpr size_t kLanes = Bytes / sizeof(T);
+  constexpr size_t kMaxBlock = std::numeric_limits<M>::max();
+  size_t res = 0;
+  size_t i = 0;
+  VM mask;
+  while (i + kLanes < count) {
+    VM acc{};
+    for (size_t block = 0; block < kMaxBlock && i + kLanes < count; block++, i += kLanes) {
+      pred(load<Bytes>(data + i), load<Bytes>(data + i + 1), mask);
+      acc -= mask;
+    }
+    for (size_t lane = 0; lane < kLanes; lane++) {
+      res += static_cast<std::make_unsigned_t<M>>(acc[lane]);
+    }
+  }
+  for (; i + 1 < count; i++) {
+    res += pred(data[i], data[i + 1]) ? 1 : 0;
+  }
+  return res;
+}
+
+template <class T, size_t Bytes>
+[[gnu::always_inline]] inline size_t count_sign_alternations(const T* data, size_t count) {
+  if constexpr (std::is_unsigned_v<T>) return 0;
+  return count_pairs<T, Bytes>(data, count, SignAlternation());
+}
+
+template <class T, size_t Bytes>
+[[gnu::always_inline]] inline size_t count_order_violations(const T* data, size_t count) {
+  return count_pairs<T, Bytes>(data, count, OrderViolation());
+}
+
+}  // namespace vec
+
+// Entry points of vector kernels for registers of Bytes
+template <size_t Bytes>
+struct VectorKernels {
+  template <class T>
+  [[gnu::always_inline]] static accumulator_t<T> sum(const T* data, size_t count) {
+    return vec::sum<T, Bytes>(data, count);
+  }
+
+  template <class T>
+  [[gnu::always_inline]] static double dot(const T* a, const T* b, size_t count) {
+    return vec::dot<T, Bytes>(a, b, count);
+  }
+
+  template <bool IsMax, class T>
+  [[gnu::always_inline]] static size_t neighbor_diff_index(const T* data, size_t count) {
+    return vec::neighbor_diff_index<IsMax, T, Bytes>(data, count);
+  }
+
+  template <class T>
+  [[gnu::always_inline]] static size_t count_sign_alternations(const T* data, size_t count) {
+    return vec::count_sign_alternations<T, Bytes>(data, count);
+  }
+
+  template <class T>
+  [[gnu::always_inline]] static size_t count_order_violations(const T* data, size_t count) {
+    return vec::count_order_violations<T, Bytes>(data, count);
+  }
+};
+
+template <>
+struct Kernels<Isa::SSE2> : VectorKernels<16> {};
+
+template <>
+struct Kernels<Isa::AVX2> {
+  template <class T>
+  PPC_TARGET_AVX2 static accumulator_t<T> sum(const T* data, size_t count) {
+    return VectorKernels<32>::sum(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX2 static double dot(const T* a, const T* b, size_t count) {
+    return VectorKernels<32>::dot(a, b, count);
+  }
+
+  template <bool IsMax, class T>
+  PPC_TARGET_AVX2 static size_t neighbor_diff_index(const T* data, size_t count) {
+    return VectorKernels<32>::neighbor_diff_index<IsMax>(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX2 static size_t count_sign_alternations(const T* data, size_t count) {
+    return VectorKernels<32>::count_sign_alternations(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX2 static size_t count_order_violations(const T* data, size_t count) {
+    return VectorKernels<32>::count_order_violations(data, count);
+  }
+};
+
+template <>
+struct Kernels<Isa::AVX512> {
+  template <class T>
+  PPC_TARGET_AVX512 static accumulator_t<T> sum(const T* data, size_t count) {
+    return VectorKernels<64>::sum(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX512 static double dot(const T* a, const T* b, size_t count) {
+    return VectorKernels<64>::dot(a, b, count);
+  }
+
+  template <bool IsMax, class T>
+  PPC_TARGET_AVX512 static size_t neighbor_diff_index(const T* data, size_t count) {
+    return VectorKernels<64>::neighbor_diff_index<IsMax>(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX512 static size_t count_sign_alternations(const T* data, size_t count) {
+    return VectorKernels<64>::count_sign_alternations(data, count);
+  }
+
+  template <class T>
+  PPC_TARGET_AVX512 static size_t count_order_violations(const T* data, size_t count) {
+    return VectorKernels<64>::count_order_violations(data, count);
+  }
+};
+
+#endif  // PPC_DISPATCH_X86
+
+template <class T>
+accumulator_t<T> sum(std::span<const T> data) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_sum", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::sum(data.data(), data.size());
+  });
+}
+
+// Products are computed in double, so integers don't overflow
+template <class T>
+double dot(std::span<const T> a, std::span<const T> b) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_dot", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::dot(a.data(), b.data(), std::min(a.size(), b.size()));
+  });
+}
+
+template <class T>
+size_t max_neighbor_diff_index(std::span<const T> data) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_max_neighbor_diff", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::template neighbor_diff_index<true>(data.data(), data.size());
+  });
+}
+
+template <class T>
+size_t min_neighbor_diff_index(std::span<const T> data) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_min_neighbor_diff", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::template neighbor_diff_index<false>(data.data(), data.size());
+  });
+}
+
+template <class T>
+size_t count_sign_alternations(std::span<const T> data) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_sign_alternations", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::count_sign_alternations(data.data(), data.size());
+  });
+}
+
+template <class T>
+size_t count_order_violations(std::span<const T> data) {
+  return ppc::core::dispatch<kMaxIsa<T>>("ref_order_violations", [&](auto isa) {
+    return Kernels<decltype(isa)::value>::count_order_violations(data.data(), data.size());
+  });
+}
+
+}  // namespace simd
+}  // namespace reference
+}  // namespace ppc
+
+#endif  // MODULES_REFERENCE_SIMD_KERNELS_HPP_
@@ -5,10 +5,11 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/simd_kernels/include/simd_kernels.hpp"
 
 namespace ppc::reference {
 
@@ -18,12 +19,8 @@ class SumOfVectorElements : public ppc::core::Task {
   explicit SumOfVectorElements(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input
+    input_ = taskData->input<InOutType>(0);
     // Init value for output
     sum = 0;
     return true;
@@ -37,7 +34,8 @@ class SumOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    sum = std::accumulate(input_.begin(), input_.end(), 0);
+    // accumulated in a wider type, only the result is narrowed
+    sum = static_cast<InOutType>(simd::sum(input_));
     return true;
   }
 
@@ -48,7 +46,7 @@ class SumOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType sum;
 };
 
@@ -6,10 +6,11 @@
 #include <gtest/gtest.h>
 
 #include <memory>
-#include <numeric>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "ref/simd_kernels/include/simd_kernels.hpp"
 
 namespace ppc {
 namespace reference {
@@ -20,17 +21,13 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   explicit SumValuesByRowsMatrix(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(taskData_) {}
   bool pre_processing() override {
     internal_order_test();
-    // Init vectors
-    input_ = std::vector<InOutType>(taskData->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Init view of input
+    input_ = taskData->input<InOutType>(0);
     rows = reinterpret_cast<IndexType*>(taskData->inputs[1])[0];
     cols = reinterpret_cast<IndexType*>(taskData->inputs[1])[1];
 
     // Init value for output
-    sum_ = std::vector<InOutType>(cols, 0.f);
+    sum_.assign(rows, 0);
     return true;
   }
 
@@ -44,7 +41,7 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   bool run() override {
     internal_order_test();
     for (size_t i = 0; i < rows; i++) {
-      sum_[i] = std::accumulate(input_.begin() + cols * i, input_.begin() + cols * (i + 1), 0.f);
+      sum_[i] = static_cast<InOutType>(simd::sum(input_.subspan(cols * i, cols)));
     }
     return true;
   }
@@ -58,7 +55,7 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   IndexType rows, cols;
   std::vector<InOutType> sum_;
 };
@@ -1,11 +1,13 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
 import multiprocessing
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (logs of perf tests, .txt, or PPC_PERF_OUTPUT records, .jsonl)')
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -16,30 +18,40 @@ list_of_type_of_tasks = ["mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
+
+def read_logs(path):
     pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
+    with open(path, "r") as logs_file:
+        for line in logs_file.readlines():
+            result = re.findall(pattern, line)
+            if len(result):
+                yield result[0][0], result[0][1], result[0][2], float(result[0][3])
 
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
 
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        result_tables[perf_type][task_name][task_type] = perf_time
+def read_records(path):
+    with open(path, "r") as records_file:
+        for line in records_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            yield record["backend"], record["task"], record["type_of_running"], float(record["time_sec"])
+
+
+if logs_path.endswith(".jsonl"):
+    perf_items = list(read_records(logs_path))
+else:
+    perf_items = list(read_logs(logs_path))
+
+for task_type, task_name, perf_type, perf_time in perf_items:
+    if perf_type not in result_tables:
+        continue
+    set_of_task_name.append(task_name)
+    result_tables[perf_type].setdefault(task_name, {ttype: -1.0 for ttype in list_of_type_of_tasks})
 
+for task_type, task_name, perf_type, perf_time in perf_items:
+    if perf_type not in result_tables:
+        continue
+    result_tables[perf_type][task_name][task_type] = perf_time
 
 for table_name in result_tables:
     workbook = xlsxwriter.Workbook(os.path.join(xlsx_path, table_name + '_perf_table.xlsx'))
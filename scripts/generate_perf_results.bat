@@ -1,4 +1,7 @@
 @echo off
 mkdir build\perf_stat_dir
+set PPC_PERF_OUTPUT=build\perf_stat_dir\perf_results.jsonl
+rem perf tests append records, results of previous runs are dropped
+if exist %PPC_PERF_OUTPUT% del %PPC_PERF_OUTPUT%
 scripts\run_perf_collector.bat > build\perf_stat_dir\perf_log.txt
-python scripts\create_perf_table.py --input build\perf_stat_dir\perf_log.txt --output build\perf_stat_dir
+python scripts\create_perf_table.py --input build\perf_stat_dir\perf_results.jsonl --output build\perf_stat_dir
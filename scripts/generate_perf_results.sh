@@ -1,3 +1,6 @@
 mkdir build/perf_stat_dir
+export PPC_PERF_OUTPUT=build/perf_stat_dir/perf_results.jsonl
+# perf tests append records, results of previous runs are dropped
+rm -f $PPC_PERF_OUTPUT
 source scripts/run_perf_collector.sh 2>&1 | tee build/perf_stat_dir/perf_log.txt
-python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_log.txt --output build/perf_stat_dir
+python3 scripts/create_perf_table.py --input build/perf_stat_dir/perf_results.jsonl --output build/perf_stat_dir
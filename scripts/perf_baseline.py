@@ -0,0 +1,148 @@
+import argparse
+import datetime
+import json
+import math
+import os
+import subprocess
+import sys
+
+# Baseline file keeps per-run samples of perf tests by host, backend, task and
+# type of running:
+#   {"version": 1, "entries": {"<host>/<backend>/<task>/<type_of_running>":
+#       {"samples_sec": [...], "median_sec": ..., "commit": "...", "date": "..."}}}
+BASELINE_VERSION = 1
+
+parser = argparse.ArgumentParser(description='Store perf baselines and compare new perf results against them')
+subparsers = parser.add_subparsers(dest='command', required=True)
+update_parser = subparsers.add_parser('update', help='Store records of PPC_PERF_OUTPUT (.jsonl) as baseline')
+update_parser.add_argument('-i', '--input', required=True, help='Perf records (.jsonl)')
+update_parser.add_argument('-b', '--baseline', default='perf_baseline.json', help='Baseline file')
+compare_parser = subparsers.add_parser('compare', help='Fail when records are significantly slower than baseline')
+compare_parser.add_argument('-i', '--input', required=True, help='Perf records (.jsonl)')
+compare_parser.add_argument('-b', '--baseline', default='perf_baseline.json', help='Baseline file')
+compare_parser.add_argument('--alpha', type=float, default=0.01, help='Significance level of Mann-Whitney U test')
+compare_parser.add_argument('--threshold', type=float, default=0.05,
+                            help='Minimal relative slowdown of median to report (default: 0.05)')
+args = parser.parse_args()
+
+
+def read_records(path):
+    with open(path, 'r') as records_file:
+        for line in records_file:
+            if line.strip():
+                yield json.loads(line)
+
+
+def record_key(record):
+    # runs of one test with other counts of workers or inputs aren't comparable
+    host = record.get('host', {}).get('name', 'unknown')
+    return '/'.join([host, record['backend'], record['task'], record['type_of_running'],
+                     'processes={}'.format(record.get('num_processes', 1)),
+                     'threads={}'.format(record.get('num_threads', 1)),
+                     'input_size={}'.format(record.get('input_size', 0))])
+
+
+def record_samples(record):
+    samples = record.get('samples_sec', [])
+    return samples if samples else [record['time_sec']]
+
+
+def median(samples):
+    ordered = sorted(samples)
+    middle = len(ordered) // 2
+    return ordered[middle] if len(ordered) % 2 else (ordered[middle - 1] + ordered[middle]) / 2.0
+
+
+def current_commit():
+    try:
+        return subprocess.run(['git', 'rev-parse', 'HEAD'], capture_output=True, text=True,
+                              check=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return 'unknown'
+
+
+def load_baseline(path):
+    if not os.path.exists(path):
+        return {'version': BASELINE_VERSION, 'entries': {}}
+    with open(path, 'r') as baseline_file:
+        baseline = json.load(baseline_file)
+    if baseline.get('version') != BASELINE_VERSION:
+        sys.exit('Unsupported version of baseline file ' + path + ': ' + str(baseline.get('version')))
+    return baseline
+
+
+def mann_whitney_greater(current, base):
+    # One-sided Mann-Whitney U test of H1: current samples are stochastically
+    # greater than base samples, normal approximation with tie correction
+    values = sorted([(value, 0) for value in current] + [(value, 1) for value in base])
+    ranks = [0.0] * len(values)
+    tie_sum = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        tie_sum += (j - i + 1) ** 3 - (j - i + 1)
+        i = j + 1
+
+    n1 = len(current)
+    n2 = len(base)
+    n = n1 + n2
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_sum / (n * (n - 1))) if n > 1 else 0.0
+    if variance <= 0.0:
+        return 1.0
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+def update():
+    baseline = load_baseline(args.baseline)
+    commit = current_commit()
+    date = datetime.datetime.now(datetime.timezone.utc).isoformat(timespec='seconds')
+    count = 0
+    for record in read_records(args.input):
+        samples = record_samples(record)
+        baseline['entries'][record_key(record)] = {'samples_sec': samples, 'median_sec': median(samples),
+                                                   'commit': commit, 'date': date}
+        count += 1
+    with open(args.baseline, 'w') as baseline_file:
+        json.dump(baseline, baseline_file, indent=2, sort_keys=True)
+        baseline_file.write('\n')
+    print('Stored ' + str(count) + ' records in ' + args.baseline)
+
+
+def compare():
+    baseline = load_baseline(args.baseline)
+    regressions = []
+    for record in read_records(args.input):
+        key = record_key(record)
+        entry = baseline['entries'].get(key)
+        if entry is None:
+            print('NEW        ' + key)
+            continue
+        samples = record_samples(record)
+        base_median = entry['median_sec']
+        current_median = median(samples)
+        change = (current_median - base_median) / base_median if base_median > 0.0 else 0.0
+        p_value = mann_whitney_greater(samples, entry['samples_sec'])
+        is_regression = p_value < args.alpha and change > args.threshold
+        status = 'REGRESSION' if is_regression else 'OK        '
+        print('{} {} median {:.6f} -> {:.6f} ({:+.1%}), p = {:.4f}'.format(
+            status, key, base_median, current_median, change, p_value))
+        if is_regression:
+            regressions.append(key)
+
+    if regressions:
+        print(str(len(regressions)) + ' significant slowdowns against ' + args.baseline)
+        sys.exit(1)
+
+
+if args.command == 'update':
+    update()
+else:
+    compare()
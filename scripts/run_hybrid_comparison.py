@@ -0,0 +1,128 @@
+import argparse
+import csv
+import json
+import multiprocessing
+import os
+import subprocess
+import sys
+import tempfile
+
+parser = argparse.ArgumentParser(
+    description='Compare MPI perf tests on the same cores as one process per core and in the hybrid mode '
+                '(fewer processes with threads), write time and resident memory of every configuration. '
+                'The build has to be configured with -D USE_MPI_HYBRID=ON.')
+parser.add_argument('-b', '--build-dir', default='build', help='Build directory with bin/mpi_perf_tests')
+parser.add_argument('-o', '--output', default=os.path.join('build', 'perf_stat_dir'), help='Output directory')
+parser.add_argument('--cores', type=int, default=multiprocessing.cpu_count(),
+                    help='Cores used by every configuration (default: count of CPUs)')
+parser.add_argument('--threads', nargs='+', type=int,
+                    help='Threads per process to compare (default: powers of two dividing --cores)')
+# only tasks which run their parts on kRankBackend use the threads of a process,
+# others run single-threaded in every configuration
+HYBRID_TASKS = ['vasilev_s_striped_horizontal_scheme']
+parser.add_argument('--filter', default=':'.join(task + '_mpi.*' for task in HYBRID_TASKS),
+                    help='gtest filter of perf tests (default: tasks converted to the hybrid mode)')
+parser.add_argument('--mpirun', default='mpirun', help='MPI launcher')
+parser.add_argument('--mpirun-args', default='--oversubscribe --bind-to none',
+                    help='Extra arguments of the launcher, e.g. "--map-by ppr:1:socket" for a process per socket')
+args = parser.parse_args()
+
+
+def default_threads(cores):
+    threads = []
+    count = 1
+    while count <= cores:
+        if cores % count == 0:
+            threads.append(count)
+        count *= 2
+    return threads
+
+
+def run_perf_tests(num_processes, num_threads):
+    binary = os.path.join(args.build_dir, 'bin', 'mpi_perf_tests')
+    if not os.path.exists(binary):
+        sys.exit(binary + ' is not found')
+
+    fd, records_path = tempfile.mkstemp(suffix='.jsonl')
+    os.close(fd)
+    env = dict(os.environ)
+    env['PPC_PERF_OUTPUT'] = records_path
+    env['PPC_PERF_FORMAT'] = 'json'
+    env['PPC_PERF_MEMORY'] = '1'
+    env['OMP_NUM_THREADS'] = str(num_threads)
+    env['PPC_NUM_THREADS'] = str(num_threads)
+    command = ([args.mpirun] + args.mpirun_args.split() + ['-np', str(num_processes), binary,
+                                                           '--gtest_filter=' + args.filter])
+    print('Run ' + ' '.join(command) + ' (threads ' + str(num_threads) + ')')
+    subprocess.run(command, env=env, stdout=subprocess.DEVNULL, check=False)
+
+    records = []
+    with open(records_path, 'r') as records_file:
+        for line in records_file:
+            if line.strip():
+                records.append(json.loads(line))
+    os.remove(records_path)
+    for record in records:
+        record['processes'] = num_processes
+        record['threads'] = num_threads
+    return records
+
+
+def comparison_rows(records):
+    groups = {}
+    skipped = set()
+    for record in records:
+        if record['task'] not in HYBRID_TASKS:
+            skipped.add(record['task'])
+            continue
+        groups.setdefault((record['task'], record['type_of_running']), []).append(record)
+
+    for task in sorted(skipped):
+        print('Skip ' + task + ': it does not use threads in the hybrid mode', file=sys.stderr)
+
+    rows = []
+    for (task, type_of_running), runs in sorted(groups.items()):
+        # one process per core is the baseline
+        base = next((run for run in runs if run['threads'] == 1), None)
+        for run in sorted(runs, key=lambda r: r['threads']):
+            memory = run.get('memory', {})
+            process_peaks = memory.get('process_peak_rss_bytes', [])
+            time = run['median_sec']
+            speedup = base['median_sec'] / time if base and time > 0.0 else ''
+            rows.append({'task': task, 'type_of_running': type_of_running, 'processes': run['processes'],
+                         'threads': run['threads'], 'median_sec': time, 'speedup': speedup,
+                         'peak_rss_bytes': memory.get('peak_rss_bytes', ''),
+                         'total_rss_bytes': sum(process_peaks) if process_peaks else ''})
+    return rows
+
+
+def write_rows(path, rows):
+    fields = ['task', 'type_of_running', 'processes', 'threads', 'median_sec', 'speedup', 'peak_rss_bytes',
+              'total_rss_bytes']
+    with open(path, 'w', newline='') as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+
+    print(os.path.basename(path))
+    for row in rows:
+        speedup_str = '' if row['speedup'] == '' else '{:.3f}'.format(row['speedup'])
+        print('  {}:{} {}x{} T={:.6f} S={} rss={} total_rss={}'.format(
+            row['task'], row['type_of_running'], row['processes'], row['threads'], row['median_sec'], speedup_str,
+            row['peak_rss_bytes'], row['total_rss_bytes']))
+
+
+threads = args.threads if args.threads else default_threads(args.cores)
+if 1 not in threads:
+    threads = [1] + threads
+os.makedirs(args.output, exist_ok=True)
+
+records = []
+for num_threads in threads:
+    records += run_perf_tests(max(args.cores // num_threads, 1), num_threads)
+
+with open(os.path.join(args.output, 'hybrid_results.jsonl'), 'w') as results_file:
+    for record in records:
+        results_file.write(json.dumps(record) + '\n')
+
+write_rows(os.path.join(args.output, 'hybrid_comparison.csv'), comparison_rows(records))
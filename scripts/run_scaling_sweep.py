@@ -0,0 +1,174 @@
+import argparse
+import csv
+import json
+import multiprocessing
+import os
+import subprocess
+import sys
+import tempfile
+
+parser = argparse.ArgumentParser(
+    description='Run perf tests over 1..N processes (mpi) or threads (omp, stl, tbb) and input scales, '
+                'write strong and weak scaling tables with speedup, efficiency and Karp-Flatt metric')
+parser.add_argument('-b', '--build-dir', default='build', help='Build directory with bin/<backend>_perf_tests')
+parser.add_argument('-o', '--output', default=os.path.join('build', 'perf_stat_dir'), help='Output directory')
+parser.add_argument('--backends', nargs='+', default=['mpi', 'omp', 'stl', 'tbb'],
+                    help='Backends to sweep (default: mpi omp stl tbb)')
+parser.add_argument('--counts', nargs='+', type=int,
+                    help='Counts of processes or threads (default: powers of two up to --max-count and itself)')
+parser.add_argument('--max-count', type=int, default=multiprocessing.cpu_count(),
+                    help='Maximal count of processes or threads (default: count of CPUs)')
+parser.add_argument('--scales', nargs='+', type=float, default=[1.0],
+                    help='Input scales (PPC_PERF_INPUT_SCALE) for strong scaling')
+parser.add_argument('--weak', action='store_true',
+                    help='Also run weak scaling: input scale grows proportionally to count of processes or threads')
+parser.add_argument('--filter', default='*', help='gtest filter of perf tests')
+parser.add_argument('--mpirun', default='mpirun', help='MPI launcher')
+args = parser.parse_args()
+
+
+def default_counts(max_count):
+    counts = []
+    count = 1
+    while count < max_count:
+        counts.append(count)
+        count *= 2
+    counts.append(max_count)
+    return counts
+
+
+def run_perf_tests(backend, count, scale):
+    binary = os.path.join(args.build_dir, 'bin', backend + '_perf_tests')
+    if not os.path.exists(binary):
+        print('Skip ' + backend + ': ' + binary + ' is not found', file=sys.stderr)
+        return []
+
+    fd, records_path = tempfile.mkstemp(suffix='.jsonl')
+    os.close(fd)
+    env = dict(os.environ)
+    env['PPC_PERF_OUTPUT'] = records_path
+    env['PPC_PERF_FORMAT'] = 'json'
+    env['PPC_PERF_INPUT_SCALE'] = str(scale)
+    command = [binary, '--gtest_filter=' + args.filter]
+    if backend == 'mpi':
+        command = [args.mpirun, '--oversubscribe', '-np', str(count)] + command
+    else:
+        env['OMP_NUM_THREADS'] = str(count)
+        env['PPC_NUM_THREADS'] = str(count)
+    print('Run ' + ' '.join(command) + ' (scale ' + str(scale) + ')')
+    subprocess.run(command, env=env, stdout=subprocess.DEVNULL, check=False)
+
+    records = []
+    with open(records_path, 'r') as records_file:
+        for line in records_file:
+            if line.strip():
+                records.append(json.loads(line))
+    os.remove(records_path)
+    for record in records:
+        record['count'] = count
+        record['scale'] = scale
+    return records
+
+
+def karp_flatt(speedup, count):
+    # experimentally determined serial fraction, undefined for one worker
+    if count <= 1 or speedup <= 0.0:
+        return ''
+    return (1.0 / speedup - 1.0 / count) / (1.0 - 1.0 / count)
+
+
+def test_key(record):
+    return record['backend'], record['task'], record['type_of_running']
+
+
+def scaling_rows(records, mode):
+    # only some tests honour PPC_PERF_INPUT_SCALE, so runs are grouped by the
+    # input size they report rather than by the requested scale
+    base_sizes = {}
+    for record in records:
+        if record['count'] == 1:
+            base_sizes[test_key(record) + (round(record['scale'], 9),)] = record['input_size']
+
+    groups = {}
+    unscaled = set()
+    for record in records:
+        base_size = record['input_size']
+        if mode == 'weak' and record['count'] > 1:
+            base_size = base_sizes.get(test_key(record) + (round(record['scale'] / record['count'], 9),))
+            if base_size is None:
+                continue
+            if base_size == record['input_size']:
+                # the input didn't grow with the count, this isn't weak scaling
+                unscaled.add(test_key(record))
+                continue
+        runs = groups.setdefault(test_key(record) + (base_size,), {})
+        if record['count'] in runs:
+            # another scale gave the same input, the test ignores the scale
+            unscaled.add(test_key(record))
+            continue
+        runs[record['count']] = record
+
+    for backend, task, type_of_running in sorted(unscaled):
+        print('Warning: {}/{}:{} ignores PPC_PERF_INPUT_SCALE, its runs with an unchanged input size are dropped'.format(
+            backend, task, type_of_running), file=sys.stderr)
+
+    rows = []
+    for (backend, task, type_of_running, base_size), runs in sorted(groups.items()):
+        if 1 not in runs:
+            continue
+        base_time = runs[1]['median_sec']
+        for count in sorted(runs):
+            time = runs[count]['median_sec']
+            if mode == 'weak':
+                # ideal weak scaling keeps time constant
+                speedup = base_time / time * count if time > 0.0 else 0.0
+                efficiency = base_time / time if time > 0.0 else 0.0
+            else:
+                speedup = base_time / time if time > 0.0 else 0.0
+                efficiency = speedup / count
+            rows.append({'backend': backend, 'task': task, 'type_of_running': type_of_running,
+                         'base_input_size': base_size, 'count': count, 'input_size': runs[count]['input_size'],
+                         'median_sec': time, 'speedup': speedup, 'efficiency': efficiency,
+                         'karp_flatt': karp_flatt(speedup, count)})
+    return rows
+
+
+def write_rows(path, rows):
+    fields = ['backend', 'task', 'type_of_running', 'base_input_size', 'count', 'input_size', 'median_sec', 'speedup',
+              'efficiency', 'karp_flatt']
+    with open(path, 'w', newline='') as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+
+    print(os.path.basename(path))
+    for row in rows:
+        karp_flatt_str = '' if row['karp_flatt'] == '' else '{:.4f}'.format(row['karp_flatt'])
+        print('  {}/{}:{} n={} p={} T={:.6f} S={:.3f} E={:.3f} e={}'.format(
+            row['backend'], row['task'], row['type_of_running'], row['input_size'], row['count'], row['median_sec'],
+            row['speedup'], row['efficiency'], karp_flatt_str))
+
+
+counts = args.counts if args.counts else default_counts(args.max_count)
+if 1 not in counts:
+    counts = [1] + counts
+os.makedirs(args.output, exist_ok=True)
+
+strong_records = []
+weak_records = []
+for backend in args.backends:
+    for count in counts:
+        for scale in args.scales:
+            strong_records += run_perf_tests(backend, count, scale)
+            if args.weak and count > 1:
+                weak_records += run_perf_tests(backend, count, scale * count)
+
+with open(os.path.join(args.output, 'scaling_results.jsonl'), 'w') as results_file:
+    for record in strong_records + weak_records:
+        results_file.write(json.dumps(record) + '\n')
+
+write_rows(os.path.join(args.output, 'strong_scaling.csv'), scaling_rows(strong_records, 'strong'))
+if args.weak:
+    # runs with one worker are shared by strong and weak scaling
+    write_rows(os.path.join(args.output, 'weak_scaling.csv'),
+               scaling_rows([r for r in strong_records if r['count'] == 1] + weak_records, 'weak'))
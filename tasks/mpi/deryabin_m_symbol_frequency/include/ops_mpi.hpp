@@ -37,7 +37,7 @@ class SymbolFrequencyMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<char> input_str_{}, local_input_str_{};
+  std::vector<char> local_input_str_{};
   int frequency_{}, local_found_{};
   char input_symbol_{};
   boost::mpi::communicator world;
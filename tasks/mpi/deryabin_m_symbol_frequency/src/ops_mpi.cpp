@@ -1,7 +1,10 @@
 #include "mpi/deryabin_m_symbol_frequency/include/ops_mpi.hpp"
 
+#include <span>
 #include <thread>
 
+#include "core/parallel/include/distribute_mpi.hpp"
+
 bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskSequential::pre_processing() {
   internal_order_test();
   // Init value for input and output
@@ -52,30 +55,14 @@ bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskParallel::validation
 
 bool deryabin_m_symbol_frequency_mpi::SymbolFrequencyMPITaskParallel::run() {
   internal_order_test();
-  unsigned int delta = 0;
-  unsigned int ostatock = 0;
+  std::span<const char> input_str;
   if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-    ostatock = taskData->inputs_count[0] % world.size();
     // Init value for input
     input_symbol_ = reinterpret_cast<char*>(taskData->inputs[1])[0];
-    input_str_ = std::vector<char>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_str_[i] = tmp_ptr[i];
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_str_.data() + (proc - 1) * delta, delta);
-    }
+    input_str = taskData->input<char>(0);
   }
-  boost::mpi::broadcast(world, delta, 0);
   boost::mpi::broadcast(world, input_symbol_, 0);
-  local_input_str_ = std::vector<char>(delta);
-  if (world.rank() == 0) {
-    local_input_str_ = std::vector<char>(input_str_.end() - delta - ostatock, input_str_.end());
-  } else {
-    world.recv(0, 0, local_input_str_.data(), delta);
-  }
+  ppc::core::mpi::distribute(world, input_str, local_input_str_);
   // Init value for output
   frequency_ = 0;
   // Init local value
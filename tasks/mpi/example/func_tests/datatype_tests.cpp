@@ -0,0 +1,70 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/distribute_mpi.hpp"
+
+namespace {
+
+struct Header {
+  int rows;
+  double scale;
+  char tag;
+};
+
+}  // namespace
+
+TEST(Datatype_MPI, Test_Transferable_Types) {
+  static_assert(ppc::core::mpi::Transferable<int>);
+  static_assert(ppc::core::mpi::Transferable<Header>);
+  static_assert(!ppc::core::mpi::Transferable<std::vector<int>>);
+  static_assert(!ppc::core::mpi::Transferable<std::string>);
+  ASSERT_EQ(ppc::core::mpi::datatype<double>(), MPI_DOUBLE);
+  int size;
+  MPI_Type_size(ppc::core::mpi::datatype<Header>(), &size);
+  ASSERT_EQ(size, static_cast<int>(sizeof(Header)));
+}
+
+TEST(Datatype_MPI, Test_Broadcast_Struct_And_Buffer) {
+  boost::mpi::communicator world;
+  Header header{};
+  std::vector<double> values;
+  if (world.rank() == 0) {
+    header = {3, 0.5, 'm'};
+    values.resize(1000);
+    std::iota(values.begin(), values.end(), 0.0);
+  }
+
+  ppc::core::mpi::broadcast_value(world, header, 0);
+  ppc::core::mpi::broadcast_buffer(world, values, 0);
+  ASSERT_EQ(header.rows, 3);
+  ASSERT_EQ(header.scale, 0.5);
+  ASSERT_EQ(header.tag, 'm');
+  ASSERT_EQ(values.size(), 1000u);
+  ASSERT_EQ(values[999], 999.0);
+}
+
+TEST(Datatype_MPI, Test_Distribute_Structs) {
+  boost::mpi::communicator world;
+  std::vector<Header> headers;
+  if (world.rank() == 0) {
+    for (int i = 0; i < 11; i++) {
+      headers.push_back({i, i * 0.25, 'h'});
+    }
+  }
+
+  std::vector<Header> local_headers;
+  auto local = ppc::core::mpi::distribute(world, std::span<const Header>(headers), local_headers);
+  auto distribution = ppc::core::mpi::balanced_distribution(11, world.size());
+  ASSERT_EQ(local.size(), static_cast<size_t>(distribution.counts[world.rank()]));
+  for (const auto& header : local) {
+    ASSERT_EQ(header.scale, header.rows * 0.25);
+    ASSERT_EQ(header.tag, 'h');
+  }
+}
@@ -0,0 +1,52 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/distribute_mpi.hpp"
+
+TEST(Distribute_MPI, Test_Balanced_Distribution) {
+  auto distribution = ppc::core::mpi::balanced_distribution(10, 4);
+  ASSERT_EQ(distribution.counts, std::vector<int>({3, 3, 2, 2}));
+  ASSERT_EQ(distribution.displs, std::vector<int>({0, 3, 6, 8}));
+}
+
+TEST(Distribute_MPI, Test_Parts_Cover_Data) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  if (world.rank() == 0) {
+    // not divisible by count of processes
+    global_vec.resize(1001);
+    std::iota(global_vec.begin(), global_vec.end(), 0);
+  }
+
+  std::vector<int> local_vec;
+  auto local = ppc::core::mpi::distribute(world, std::span<const int>(global_vec), local_vec);
+  auto distribution = ppc::core::mpi::balanced_distribution(1001, world.size());
+  ASSERT_EQ(local.size(), static_cast<size_t>(distribution.counts[world.rank()]));
+  for (size_t i = 0; i < local.size(); i++) {
+    ASSERT_EQ(local[i], distribution.displs[world.rank()] + static_cast<int>(i));
+  }
+
+  std::vector<int> sizes;
+  boost::mpi::gather(world, static_cast<int>(local.size()), sizes, 0);
+  if (world.rank() == 0) {
+    ASSERT_EQ(std::accumulate(sizes.begin(), sizes.end(), 0), 1001);
+  }
+}
+
+TEST(Distribute_MPI, Test_Less_Elements_Than_Processes) {
+  boost::mpi::communicator world;
+  std::vector<char> global_str;
+  if (world.rank() == 0) {
+    global_str = {'a'};
+  }
+
+  std::vector<char> local_str;
+  auto local = ppc::core::mpi::distribute(world, std::span<const char>(global_str), local_str);
+  ASSERT_EQ(local.size(), world.rank() == 0 ? 1u : 0u);
+}
@@ -0,0 +1,39 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include "core/parallel/include/hybrid_mpi.hpp"
+
+TEST(Hybrid_MPI, Test_Node_Communicator) {
+  boost::mpi::communicator world;
+  auto node = ppc::core::mpi::node_communicator(world);
+  ASSERT_GE(node.size(), 1);
+  ASSERT_LE(node.size(), world.size());
+
+  // every process is counted on exactly one node
+  int leaders = node.rank() == 0 ? node.size() : 0;
+  int total = 0;
+  boost::mpi::all_reduce(world, leaders, total, std::plus<>());
+  ASSERT_EQ(total, world.size());
+}
+
+#ifndef _WIN32
+TEST(Hybrid_MPI, Test_Rank_Num_Threads) {
+  ASSERT_GE(ppc::core::mpi::rank_num_threads(1), 1u);
+  ASSERT_GE(ppc::core::mpi::rank_num_threads(1 << 20), 1u);
+  const char* previous = std::getenv("PPC_NUM_THREADS");
+  std::string saved = previous != nullptr ? previous : "";
+  setenv("PPC_NUM_THREADS", "3", 1);
+  ASSERT_EQ(ppc::core::mpi::rank_num_threads(4), 3u);
+  if (previous != nullptr) {
+    setenv("PPC_NUM_THREADS", saved.c_str(), 1);
+  } else {
+    unsetenv("PPC_NUM_THREADS");
+  }
+}
+#endif
@@ -5,6 +5,7 @@
 #include <boost/mpi/environment.hpp>
 #include <vector>
 
+#include "core/parallel/include/hybrid_mpi.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
 
 TEST(Parallel_Operations_MPI, Test_Sum) {
@@ -228,8 +229,9 @@ TEST(Parallel_Operations_MPI, Test_Max_2) {
 }
 
 int main(int argc, char** argv) {
-  boost::mpi::environment env(argc, argv);
+  boost::mpi::environment env(argc, argv, ppc::core::mpi::kThreadingLevel);
   boost::mpi::communicator world;
+  ppc::core::mpi::init_hybrid(world);
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
   if (world.rank() != 0) {
@@ -0,0 +1,110 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/parallel_reduce_mpi.hpp"
+#include "core/parallel/include/pipelined_reduce_mpi.hpp"
+
+TEST(Parallel_Reduce_MPI, Test_Sum_Uneven_Parts) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  if (world.rank() == 0) {
+    // not divisible by count of processes
+    global_vec.resize(100003);
+    std::iota(global_vec.begin(), global_vec.end(), -50000);
+  }
+
+  auto res = ppc::core::mpi::parallel_reduce(world, std::span<const int>(global_vec), 0);
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, std::accumulate(global_vec.begin(), global_vec.end(), 0));
+  }
+}
+
+TEST(Parallel_Reduce_MPI, Test_Max_On_Threads) {
+  boost::mpi::communicator world;
+  std::vector<double> global_vec;
+  if (world.rank() == 0) {
+    global_vec.assign(50000, 1.5);
+    global_vec[31337] = 7.25;
+  }
+
+  auto max = [](double a, double b) { return std::max(a, b); };
+  auto res = ppc::core::mpi::parallel_reduce<ppc::core::Backend::STL>(
+      world, std::span<const double>(global_vec), std::numeric_limits<double>::lowest(), max);
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, 7.25);
+  }
+}
+
+TEST(Parallel_Reduce_MPI, Test_Less_Elements_Than_Processes) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  if (world.rank() == 0) {
+    global_vec = {5};
+  }
+
+  auto res = ppc::core::mpi::parallel_reduce(world, std::span<const int>(global_vec), 1, std::multiplies<>());
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, 5);
+  }
+}
+
+TEST(Parallel_Reduce_MPI, Test_Pipeline_Blocks) {
+  ASSERT_EQ(ppc::core::mpi::pipeline_blocks(1000, 4), 1u);
+  ASSERT_EQ(ppc::core::mpi::pipeline_blocks(ppc::core::mpi::kMinPipelineBlock * 12, 4), 3u);
+  ASSERT_EQ(ppc::core::mpi::pipeline_blocks(ppc::core::mpi::kMinPipelineBlock * 1000, 4),
+            ppc::core::mpi::kPipelineBlocks);
+  ASSERT_EQ(ppc::core::mpi::pipeline_blocks(ppc::core::mpi::kMinPipelineBlock * 1000, 4, 2), 2u);
+}
+
+TEST(Parallel_Reduce_MPI, Test_Pipelined_Dot_Product) {
+  boost::mpi::communicator world;
+  std::vector<int> a;
+  std::vector<int> b;
+  if (world.rank() == 0) {
+    // several blocks per process with remainders in blocks and parts
+    a.resize(world.size() * ppc::core::mpi::kMinPipelineBlock * 3 + 7);
+    b.resize(a.size());
+    for (size_t i = 0; i < a.size(); i++) {
+      a[i] = static_cast<int>(i % 7) - 3;
+      b[i] = static_cast<int>(i % 5);
+    }
+  }
+
+  std::array<std::vector<int>, 2> local;
+  auto dot = [](const auto& block) {
+    return std::inner_product(block[0].begin(), block[0].end(), block[1].begin(), 0);
+  };
+  auto res = ppc::core::mpi::pipelined_reduce(world, std::array{std::span<const int>(a), std::span<const int>(b)},
+                                              local, dot, 0);
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, std::inner_product(a.begin(), a.end(), b.begin(), 0));
+  }
+}
+
+TEST(Parallel_Reduce_MPI, Test_Pipelined_Max_Of_Short_Input) {
+  boost::mpi::communicator world;
+  std::vector<double> values;
+  if (world.rank() == 0) {
+    values = {1.5, -2.0, 9.25};
+  }
+
+  std::array<std::vector<double>, 1> local;
+  auto max = [](const auto& block) {
+    return std::accumulate(block[0].begin(), block[0].end(), std::numeric_limits<double>::lowest(),
+                           [](double a, double b) { return std::max(a, b); });
+  };
+  auto res = ppc::core::mpi::pipelined_reduce(world, std::array{std::span<const double>(values)}, local, max,
+                                              std::numeric_limits<double>::lowest(), boost::mpi::maximum<double>());
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, 9.25);
+  }
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/perf/include/perf_mpi.hpp"
+
+TEST(Perf_MPI, Test_Gather_Memory_Usage) {
+  boost::mpi::communicator world;
+  ppc::core::PerfResults perfResults;
+  perfResults.peak_rss_bytes = static_cast<uint64_t>(world.rank()) + 1;
+
+  ppc::core::mpi::gather_memory_usage(world, perfResults);
+  if (world.rank() == 0) {
+    std::vector<uint64_t> expected(world.size());
+    std::iota(expected.begin(), expected.end(), 1);
+    ASSERT_EQ(perfResults.process_peak_rss_bytes, expected);
+  }
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "core/parallel/include/shared_buffer_mpi.hpp"
+
+TEST(Shared_Buffer_MPI, Test_Read_On_All_Processes) {
+  boost::mpi::communicator world;
+  std::vector<double> values;
+  if (world.rank() == 0) {
+    values.resize(10000);
+    std::iota(values.begin(), values.end(), 0.5);
+  }
+
+  ppc::core::mpi::SharedBuffer<double> shared;
+  shared.assign(world, values);
+  auto view = shared.view();
+  ASSERT_EQ(view.size(), 10000u);
+  ASSERT_EQ(view[0], 0.5);
+  ASSERT_EQ(view[9999], 9999.5);
+}
+
+TEST(Shared_Buffer_MPI, Test_Reassign_From_Other_Root) {
+  boost::mpi::communicator world;
+  int root = world.size() - 1;
+  ppc::core::mpi::SharedBuffer<int> shared;
+  for (int size : {100, 30, 5000, 0}) {
+    std::vector<int> values;
+    if (world.rank() == root) {
+      values.assign(size, size);
+    }
+    shared.assign(world, values, root);
+    auto view = shared.view();
+    ASSERT_EQ(view.size(), static_cast<size_t>(size));
+    for (int value : view) {
+      ASSERT_EQ(value, size);
+    }
+  }
+}
@@ -4,7 +4,9 @@
 #include <boost/mpi/timer.hpp>
 #include <vector>
 
+#include "core/parallel/include/hybrid_mpi.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_mpi.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
 
 TEST(mpi_example_perf_test, test_pipeline_run) {
@@ -15,7 +17,7 @@ TEST(mpi_example_perf_test, test_pipeline_run) {
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   int count_size_vector;
   if (world.rank() == 0) {
-    count_size_vector = 120;
+    count_size_vector = static_cast<int>(ppc::core::Perf::scaled_input_size(120));
     global_vec = std::vector<int>(count_size_vector, 1);
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
     taskDataPar->inputs_count.emplace_back(global_vec.size());
@@ -41,6 +43,7 @@ TEST(mpi_example_perf_test, test_pipeline_run) {
   // Create Perf analyzer
   auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  ppc::core::mpi::gather_memory_usage(world, *perfResults);
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
     ASSERT_EQ(count_size_vector, global_sum[0]);
@@ -55,7 +58,7 @@ TEST(mpi_example_perf_test, test_task_run) {
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   int count_size_vector;
   if (world.rank() == 0) {
-    count_size_vector = 120;
+    count_size_vector = static_cast<int>(ppc::core::Perf::scaled_input_size(120));
     global_vec = std::vector<int>(count_size_vector, 1);
     taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
     taskDataPar->inputs_count.emplace_back(global_vec.size());
@@ -88,8 +91,9 @@ TEST(mpi_example_perf_test, test_task_run) {
 }
 
 int main(int argc, char** argv) {
-  boost::mpi::environment env(argc, argv);
+  boost::mpi::environment env(argc, argv, ppc::core::mpi::kThreadingLevel);
   boost::mpi::communicator world;
+  ppc::core::mpi::init_hybrid(world);
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
   if (world.rank() != 0) {
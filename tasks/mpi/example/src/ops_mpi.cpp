@@ -3,11 +3,15 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/parallel/include/distribute_mpi.hpp"
+#include "core/parallel/include/parallel_reduce.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> nesterov_a_test_task_mpi::getRandomVector(int sz) {
@@ -22,12 +26,8 @@ std::vector<int> nesterov_a_test_task_mpi::getRandomVector(int sz) {
 
 bool nesterov_a_test_task_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input
+  input_ = taskData->input<int>(0);
   // Init value for output
   res = 0;
   return true;
@@ -57,30 +57,19 @@ bool nesterov_a_test_task_mpi::TestMPITaskSequential::post_processing() {
   return true;
 }
 
+void nesterov_a_test_task_mpi::TestMPITaskParallel::prepare(size_t capacity) {
+  local_input_.reserve(capacity / world.size() + 1);
+}
+
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-  }
-  broadcast(world, delta, 0);
-
   if (world.rank() == 0) {
-    // Init vectors
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
+    // Init view of input
+    input_ = taskData->input<int>(0);
   }
-  local_input_ = std::vector<int>(delta);
-  if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
+  {
+    auto section = measure_section("scatter");
+    ppc::core::mpi::distribute(world, input_, local_input_);
   }
   // Init value for output
   res = 0;
@@ -99,14 +88,19 @@ bool nesterov_a_test_task_mpi::TestMPITaskParallel::validation() {
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::run() {
   internal_order_test();
   int local_res;
-  if (ops == "+") {
-    local_res = std::accumulate(local_input_.begin(), local_input_.end(), 0);
-  } else if (ops == "-") {
-    local_res = -std::accumulate(local_input_.begin(), local_input_.end(), 0);
-  } else if (ops == "max") {
-    local_res = *std::max_element(local_input_.begin(), local_input_.end());
+  {
+    auto section = measure_section("compute");
+    if (ops == "+") {
+      local_res = ppc::core::parallel_reduce<ppc::core::Backend::SEQ>(local_input_, 0);
+    } else if (ops == "-") {
+      local_res = -ppc::core::parallel_reduce<ppc::core::Backend::SEQ>(local_input_, 0);
+    } else if (ops == "max") {
+      local_res = ppc::core::parallel_reduce<ppc::core::Backend::SEQ>(
+          local_input_, std::numeric_limits<int>::min(), [](int a, int b) { return std::max(a, b); });
+    }
   }
 
+  auto section = measure_section("reduce");
   if (ops == "+" || ops == "-") {
     reduce(world, local_res, res, std::plus(), 0);
   } else if (ops == "max") {
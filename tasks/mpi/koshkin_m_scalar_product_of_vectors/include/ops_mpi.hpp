@@ -3,10 +3,12 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,9 +40,8 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_{};
-  std::vector<int> local_input1_{}, local_input2_{};
-  std::vector<unsigned int> counts_{};
+  std::array<std::span<const int>, 2> input_{};
+  std::array<std::vector<int>, 2> local_input_{};
   int res{};
   boost::mpi::communicator world;
 };
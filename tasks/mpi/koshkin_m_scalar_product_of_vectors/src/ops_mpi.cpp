@@ -3,9 +3,12 @@
 
 #include <algorithm>
 #include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 
+#include "core/parallel/include/pipelined_reduce_mpi.hpp"
+
 bool koshkin_m_scalar_product_of_vectors::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   input_ = std::vector<std::vector<int>>(taskData->inputs.size());
@@ -43,30 +46,10 @@ bool koshkin_m_scalar_product_of_vectors::TestMPITaskSequential::post_processing
 
 bool koshkin_m_scalar_product_of_vectors::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  size_t total_el = 0;
-  size_t base_el = 0;
-  size_t extra_el = 0;
-  if (world.rank() == 0) {
-    total_el = taskData->inputs_count[0];
-    base_el = total_el / world.size();
-    extra_el = total_el % world.size();
-  }
-  counts_.resize(world.size());
-
   if (world.rank() == 0) {
-    counts_.assign(world.size(), base_el);
-    std::fill(counts_.begin(), counts_.begin() + extra_el, base_el + 1);
-  }
-  boost::mpi::broadcast(world, counts_.data(), world.size(), 0);
-
-  if (world.rank() == 0) {
-    input_ = std::vector<std::vector<int>>(taskData->inputs.size());
+    // Init views of input
     for (size_t i = 0; i < input_.size(); i++) {
-      auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-      input_[i] = std::vector<int>(taskData->inputs_count[i]);
-      for (size_t j = 0; j < taskData->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
+      input_[i] = taskData->input<int>(i);
     }
   }
   res = 0;
@@ -85,33 +68,12 @@ bool koshkin_m_scalar_product_of_vectors::TestMPITaskParallel::validation() {
 
 bool koshkin_m_scalar_product_of_vectors::TestMPITaskParallel::run() {
   internal_order_test();
-  if (world.rank() == 0) {
-    size_t offset_extra = counts_[0];
-    for (int proces = 1; proces < world.size(); proces++) {
-      size_t cur_accout = counts_[proces];
-      world.send(proces, 0, input_[0].data() + offset_extra, cur_accout);
-      world.send(proces, 1, input_[1].data() + offset_extra, cur_accout);
-      offset_extra += cur_accout;
-    }
-  }
-
-  local_input1_ = std::vector<int>(counts_[world.rank()]);
-  local_input2_ = std::vector<int>(counts_[world.rank()]);
-
-  if (world.rank() > 0) {
-    world.recv(0, 0, local_input1_.data(), counts_[world.rank()]);
-    world.recv(0, 1, local_input2_.data(), counts_[world.rank()]);
-  } else {
-    local_input1_ = std::vector<int>(input_[0].begin(), input_[0].begin() + counts_[0]);
-    local_input2_ = std::vector<int>(input_[1].begin(), input_[1].begin() + counts_[0]);
-  }
-
-  int local_res = 0;
-
-  for (size_t i = 0; i < local_input1_.size(); i++) {
-    local_res += local_input1_[i] * local_input2_[i];
-  }
-  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  // Scatter of the next block and reduce of the previous one overlap the
+  // product of the current block
+  res = ppc::core::mpi::pipelined_reduce(
+      world, input_, local_input_,
+      [](const auto& block) { return std::inner_product(block[0].begin(), block[0].end(), block[1].begin(), 0); },
+      0);
   return true;
 }
 
@@ -1,7 +1,9 @@
 #pragma once
+#include <array>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <random>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -28,10 +30,9 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_;
-  std::vector<int> local_input1_, local_input2_;
+  std::array<std::span<const int>, 2> input_;
+  std::array<std::vector<int>, 2> local_input_;
   int result{};
   boost::mpi::communicator world;
-  unsigned int delta;
 };
 }  // namespace kudryashova_i_vector_dot_product_mpi
@@ -1,6 +1,9 @@
 #include "mpi/kudryashova_i_vector_dot_product/include/vectorDotProductMPI.hpp"
 
 #include <boost/mpi.hpp>
+#include <numeric>
+
+#include "core/parallel/include/pipelined_reduce_mpi.hpp"
 
 int kudryashova_i_vector_dot_product_mpi::vectorDotProduct(const std::vector<int>& vector1,
                                                            const std::vector<int>& vector2) {
@@ -46,21 +49,11 @@ bool kudryashova_i_vector_dot_product_mpi::TestMPITaskSequential::post_processin
 bool kudryashova_i_vector_dot_product_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
   if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-    if ((int)(taskData->inputs_count[0]) < world.size()) {
-      delta = taskData->inputs_count[0];
-    }
-  }
-  if (world.rank() == 0) {
-    input_.resize(taskData->inputs.size());
-    for (size_t i = 0; i < taskData->inputs.size(); ++i) {
+    for (size_t i = 0; i < input_.size(); ++i) {
       if (taskData->inputs[i] == nullptr || taskData->inputs_count[i] == 0) {
         return false;
       }
-      input_[i].resize(taskData->inputs_count[i]);
-      int* source_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-
-      std::copy(source_ptr, source_ptr + taskData->inputs_count[i], input_[i].begin());
+      input_[i] = taskData->input<int>(i);
     }
   }
   return true;
@@ -79,32 +72,10 @@ bool kudryashova_i_vector_dot_product_mpi::TestMPITaskParallel::validation() {
 
 bool kudryashova_i_vector_dot_product_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  broadcast(world, delta, 0);
-  if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); ++proc) {
-      world.send(proc, 0, input_[0].data() + proc * delta, delta);
-      world.send(proc, 1, input_[1].data() + proc * delta, delta);
-    }
-  }
-  local_input1_.resize(delta);
-  local_input2_.resize(delta);
-  if (world.rank() == 0) {
-    std::copy(input_[0].begin(), input_[0].begin() + delta, local_input1_.begin());
-    std::copy(input_[1].begin(), input_[1].begin() + delta, local_input2_.begin());
-  } else {
-    world.recv(0, 0, local_input1_.data(), delta);
-    world.recv(0, 1, local_input2_.data(), delta);
-  }
-  int local_result = std::inner_product(local_input1_.begin(), local_input1_.end(), local_input2_.begin(), 0);
-  std::vector<int> full_results;
-  gather(world, local_result, full_results, 0);
-
-  if (world.rank() == 0) {
-    result = std::accumulate(full_results.begin(), full_results.end(), 0);
-  }
-  if (world.rank() == 0 && (int)(taskData->inputs_count[0]) < world.size()) {
-    result = std::inner_product(input_[0].begin(), input_[0].end(), input_[1].begin(), 0);
-  }
+  result = ppc::core::mpi::pipelined_reduce(
+      world, input_, local_input_,
+      [](const auto& block) { return std::inner_product(block[0].begin(), block[0].end(), block[1].begin(), 0); },
+      0);
   return true;
 }
 
@@ -110,6 +110,60 @@ TEST(shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi, rec_4x8_8x16) { RunMatr
 
 TEST(shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi, rec_1x7_7x16) { RunMatrixMultiplicationTest(1, 7, 16); }
 
+TEST(shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi, rec_3x4_4x2_described) {
+  boost::mpi::communicator world;
+
+  const int rowA = 3;
+  const int colA = 4;
+  const int colB = 2;
+
+  std::vector<int> global_matrix_a;
+  std::vector<int> global_matrix_b;
+  std::vector<int> global_result_parallel;
+  std::vector<int> global_result_sequential;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    global_matrix_a = shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::getRandomMatrix(rowA, colA);
+    global_matrix_b = shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::getRandomMatrix(colA, colB);
+    global_result_parallel.resize(rowA * colB, 0);
+    global_result_sequential.resize(rowA * colB, 0);
+
+    auto desc_a = ppc::core::BufferDesc::make<int>({rowA, colA});
+    auto desc_b = ppc::core::BufferDesc::make<int>({colA, colB});
+    auto desc_c = ppc::core::BufferDesc::make<int>({rowA, colB});
+
+    taskDataPar->add_input(global_matrix_a.data(), desc_a);
+    taskDataPar->add_input(global_matrix_b.data(), desc_b);
+    taskDataPar->add_output(global_result_parallel.data(), desc_c);
+
+    taskDataSeq->add_input(global_matrix_a.data(), desc_a);
+    taskDataSeq->add_input(global_matrix_b.data(), desc_b);
+    taskDataSeq->add_output(global_result_sequential.data(), desc_c);
+  }
+
+  auto taskParallel =
+      std::make_shared<shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskParallel>(
+          taskDataPar);
+  ASSERT_TRUE(taskParallel->validation());
+  taskParallel->pre_processing();
+  taskParallel->run();
+  taskParallel->post_processing();
+
+  if (world.rank() == 0) {
+    auto taskSequential =
+        std::make_shared<shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskSequential>(
+            taskDataSeq);
+    ASSERT_TRUE(taskSequential->validation());
+    taskSequential->pre_processing();
+    taskSequential->run();
+    taskSequential->post_processing();
+    ASSERT_EQ(global_result_parallel, global_result_sequential);
+  }
+}
+
 TEST(shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi, validation_zero_matrix) {
   boost::mpi::communicator world;
 
@@ -2,15 +2,19 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <boost/mpi.hpp>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/shared_buffer_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi {
@@ -39,6 +43,16 @@ class Matrix {
     ar & matrix_;
   }
 
+  // Dimensions and elements go as native MPI types, without serialize()
+  void broadcast(const boost::mpi::communicator& comm, int root) {
+    std::array<size_t, 2> dims{rows_, cols_};
+    ppc::core::mpi::broadcast_value(comm, dims, root);
+    rows_ = dims[0];
+    cols_ = dims[1];
+    matrix_.resize(rows_ * cols_);
+    ppc::core::mpi::broadcast_buffer(comm, std::span<int>(matrix_), root);
+  }
+
   class RowIterator {
    public:
     RowIterator(const int* ptr) : ptr_(ptr) {}
@@ -86,6 +100,9 @@ class Matrix {
   size_t rows_, cols_;
 };
 
+// Dimensions come from descriptions of matrices A and B if they are present,
+// otherwise from scalar inputs 2..4
+bool read_dimensions(const ppc::core::TaskData& taskData, int& rows_a, int& cols_a, int& cols_b);
 void get_indexes(int num_rows_a_, int num_rows_b_, std::vector<int>& indexesA, std::vector<int>& indexesB);
 void calculate(int rows, int cols, int num_proc, std::vector<int>& sizes, std::vector<int>& displs);
 
@@ -126,6 +143,7 @@ class MatrixMultiplicationTaskParallel : public ppc::core::Task {
   std::vector<int> indexesB_;
   Matrix matA;
   Matrix matB;
+  ppc::core::mpi::SharedBuffer<int> shared_b_;
   std::vector<int> sizes;
   std::vector<int> displs;
 
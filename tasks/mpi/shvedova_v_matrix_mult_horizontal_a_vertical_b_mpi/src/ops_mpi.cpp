@@ -25,9 +25,7 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
   input_matrix_a_.assign(matrix_a_data, matrix_a_data + matrix_a_size);
   input_matrix_b_.assign(matrix_b_data, matrix_b_data + matrix_b_size);
 
-  num_rows_a_ = *reinterpret_cast<int*>(taskData->inputs[2]);
-  num_cols_a_ = *reinterpret_cast<int*>(taskData->inputs[3]);
-  num_cols_b_ = *reinterpret_cast<int*>(taskData->inputs[4]);
+  read_dimensions(*taskData, num_rows_a_, num_cols_a_, num_cols_b_);
 
   int result_size = taskData->outputs_count[0];
   result_vector_.resize(result_size, 0);
@@ -41,11 +39,10 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskSequential::validation() {
   internal_order_test();
 
-  int num_r_a_ = *reinterpret_cast<int*>(taskData->inputs[2]);
-  int num_c_a_ = *reinterpret_cast<int*>(taskData->inputs[3]);
-  int num_c_b_ = *reinterpret_cast<int*>(taskData->inputs[4]);
-
-  return (taskData->inputs_count.size() > 3 && !taskData->outputs_count.empty() &&
+  int num_r_a_;
+  int num_c_a_;
+  int num_c_b_;
+  return (read_dimensions(*taskData, num_r_a_, num_c_a_, num_c_b_) && !taskData->outputs_count.empty() &&
           (num_r_a_ * num_c_a_ * num_c_b_ != 0));
 }
 
@@ -77,6 +74,30 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
   return true;
 }
 
+bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::read_dimensions(const ppc::core::TaskData& taskData,
+                                                                         int& rows_a, int& cols_a, int& cols_b) {
+  const auto* desc_a = taskData.input_desc(0);
+  const auto* desc_b = taskData.input_desc(1);
+  if (desc_a != nullptr && desc_b != nullptr) {
+    if (desc_a->shape.size() != 2 || desc_b->shape.size() != 2 || !desc_a->is_contiguous() ||
+        !desc_b->is_contiguous() || !desc_a->is_row_major() || !desc_b->is_row_major() ||
+        desc_a->cols() != desc_b->rows()) {
+      return false;
+    }
+    rows_a = static_cast<int>(desc_a->rows());
+    cols_a = static_cast<int>(desc_a->cols());
+    cols_b = static_cast<int>(desc_b->cols());
+    return true;
+  }
+  if (taskData.inputs_count.size() <= 4) {
+    return false;
+  }
+  rows_a = *reinterpret_cast<int*>(taskData.inputs[2]);
+  cols_a = *reinterpret_cast<int*>(taskData.inputs[3]);
+  cols_b = *reinterpret_cast<int*>(taskData.inputs[4]);
+  return true;
+}
+
 void shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::get_indexes(int num_rows_a_, int num_rows_b_,
                                                                      std::vector<int>& indexesA,
                                                                      std::vector<int>& indexesB) {
@@ -134,9 +155,7 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
     input_matrix_a_.assign(matrix_a_data, matrix_a_data + matrix_a_size);
     input_matrix_b_.assign(matrix_b_data, matrix_b_data + matrix_b_size);
 
-    num_rows_a_ = *reinterpret_cast<int*>(taskData->inputs[2]);
-    num_cols_a_ = *reinterpret_cast<int*>(taskData->inputs[3]);
-    num_cols_b_ = *reinterpret_cast<int*>(taskData->inputs[4]);
+    read_dimensions(*taskData, num_rows_a_, num_cols_a_, num_cols_b_);
 
     int result_size = taskData->outputs_count[0];
     result_vector_.resize(result_size, 0);
@@ -156,10 +175,10 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    int num_r_a_ = *reinterpret_cast<int*>(taskData->inputs[2]);
-    int num_c_a_ = *reinterpret_cast<int*>(taskData->inputs[3]);
-    int num_c_b_ = *reinterpret_cast<int*>(taskData->inputs[4]);
-    return (taskData->inputs_count.size() > 3 && !taskData->outputs_count.empty() &&
+    int num_r_a_;
+    int num_c_a_;
+    int num_c_b_;
+    return (read_dimensions(*taskData, num_r_a_, num_c_a_, num_c_b_) && !taskData->outputs_count.empty() &&
             (num_r_a_ * num_c_a_ * num_c_b_ != 0));
   }
   return true;
@@ -168,15 +187,19 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
 bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTaskParallel::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, matA, 0);
-  boost::mpi::broadcast(world, matB, 0);
-  boost::mpi::broadcast(world, sizes, 0);
-  boost::mpi::broadcast(world, displs, 0);
+  matA.broadcast(world, 0);
+  // B is read by all processes, one copy of it per node is read in place
+  ppc::core::mpi::broadcast_value(world, num_cols_a_, 0);
+  ppc::core::mpi::broadcast_value(world, num_cols_b_, 0);
+  shared_b_.assign(world, matB.matrix_, 0);
+  auto mat_b = shared_b_.view();
+  ppc::core::mpi::broadcast_buffer(world, sizes, 0);
+  ppc::core::mpi::broadcast_buffer(world, displs, 0);
 
   int local_size = sizes[world.rank()];
 
-  std::vector<int> local_indexes_a(local_size);
-  std::vector<int> local_indexes_b(local_size);
+  auto local_indexes_a = scratch<int>(local_size);
+  auto local_indexes_b = scratch<int>(local_size);
 
   if (world.rank() == 0) {
     boost::mpi::scatterv(world, indexesA_.data(), sizes, displs, local_indexes_a.data(), local_size, 0);
@@ -186,19 +209,15 @@ bool shvedova_v_matrix_mult_horizontal_a_vertical_b_mpi::MatrixMultiplicationTas
     boost::mpi::scatterv(world, local_indexes_b.data(), local_size, 0);
   }
 
-  std::vector<int> local_result(local_size, 0);
+  auto local_result = scratch<int>(local_size);
 
   for (size_t k = 0; k < local_indexes_a.size(); ++k) {
     int i = local_indexes_a[k];
     int j = local_indexes_b[k];
 
     auto itA = matA.row_begin(i);
-    auto itB = matB.col_begin(j);
-
-    while (itA != matA.row_end(i) && itB != matB.col_end(j)) {
-      local_result[k] += (*itA) * (*itB);
-      ++itA;
-      ++itB;
+    for (int c = 0; c < num_cols_a_; ++c, ++itA) {
+      local_result[k] += (*itA) * mat_b[c * num_cols_b_ + j];
     }
   }
 
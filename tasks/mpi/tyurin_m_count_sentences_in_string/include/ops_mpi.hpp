@@ -38,7 +38,7 @@ class SentenceCountTaskParallel : public ppc::core::Task {
 
  private:
   std::string input_str_;
-  std::string local_input_;
+  std::vector<char> local_input_;
   int sentence_count_ = 0;
   int local_sentence_count_ = 0;
 
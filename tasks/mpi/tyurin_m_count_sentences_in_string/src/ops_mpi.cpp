@@ -1,8 +1,11 @@
 #include "mpi/tyurin_m_count_sentences_in_string/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <span>
 #include <thread>
 
+#include "core/parallel/include/distribute_mpi.hpp"
+
 using namespace std::chrono_literals;
 
 bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskSequential::pre_processing() {
@@ -72,28 +75,7 @@ bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::validati
 bool tyurin_m_count_sentences_in_string_mpi::SentenceCountTaskParallel::run() {
   internal_order_test();
 
-  size_t total_length{};
-  if (world.rank() == 0) {
-    total_length = input_str_.size();
-  }
-  boost::mpi::broadcast(world, total_length, 0);
-
-  std::string local_segment;
-  size_t segment_size = total_length / world.size();
-  size_t remainder = 0;
-
-  if (world.rank() == 0) {
-    remainder = total_length % world.size();
-
-    for (int rank = 1; rank < world.size(); rank++) {
-      world.send(rank, 0, input_str_.data() + rank * segment_size + remainder, segment_size);
-    }
-
-    local_segment.assign(input_str_, 0, segment_size + remainder);
-  } else {
-    local_segment.resize(segment_size);
-    world.recv(0, 0, local_segment.data(), segment_size);
-  }
+  auto local_segment = ppc::core::mpi::distribute(world, std::span<const char>(input_str_), local_input_);
 
   bool in_sentence = false;
 
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/memory/include/numa_allocator.hpp"
+#include "core/parallel/include/shared_buffer_mpi.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vasilev_s_striped_horizontal_scheme_mpi {
@@ -32,6 +34,10 @@ class StripedHorizontalSchemeParallelMPI : public ppc::core::Task {
   int num_cols_;
   std::vector<int> distribution;
   std::vector<int> displacement;
+  std::vector<int> gather_counts;
+  std::vector<int> gather_displacements;
+  ppc::core::mpi::SharedBuffer<int> shared_vector_;
+  ppc::core::numa_vector<int> local_matrix_;
   boost::mpi::communicator world;
 };
 
@@ -6,7 +6,9 @@
 #include <random>
 #include <vector>
 
+#include "core/parallel/include/hybrid_mpi.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_mpi.hpp"
 #include "mpi/vasilev_s_striped_horizontal_scheme/include/ops_mpi.hpp"
 
 namespace vasilev_s_striped_horizontal_scheme_mpi {
@@ -75,6 +77,7 @@ TEST(vasilev_s_striped_horizontal_scheme_mpi, Performance_Pipeline_Run) {
 
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
+  perfAttr->num_threads = ppc::core::backend_num_threads<ppc::core::mpi::kRankBackend>();
   const boost::mpi::timer current_timer;
   perfAttr->current_timer = [&] { return current_timer.elapsed(); };
 
@@ -82,6 +85,8 @@ TEST(vasilev_s_striped_horizontal_scheme_mpi, Performance_Pipeline_Run) {
 
   auto perfAnalyzer = std::make_shared<ppc::core::Perf>(taskParallel);
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
+  // Resident memory of all processes, it shrinks in the hybrid mode
+  ppc::core::mpi::gather_memory_usage(world, *perfResults);
 
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
@@ -152,6 +157,7 @@ TEST(vasilev_s_striped_horizontal_scheme_mpi, Performance_Task_Run) {
 
   auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
   perfAttr->num_running = 10;
+  perfAttr->num_threads = ppc::core::backend_num_threads<ppc::core::mpi::kRankBackend>();
   const boost::mpi::timer current_timer;
   perfAttr->current_timer = [&] { return current_timer.elapsed(); };
 
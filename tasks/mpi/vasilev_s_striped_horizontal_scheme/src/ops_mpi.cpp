@@ -9,6 +9,9 @@
 #include <numeric>
 #include <vector>
 
+#include "core/parallel/include/datatype_mpi.hpp"
+#include "core/parallel/include/hybrid_mpi.hpp"
+
 void vasilev_s_striped_horizontal_scheme_mpi::calculate_distribution(int rows, int cols, int num_proc,
                                                                      std::vector<int>& sizes,
                                                                      std::vector<int>& displs) {
@@ -106,32 +109,42 @@ bool vasilev_s_striped_horizontal_scheme_mpi::StripedHorizontalSchemeParallelMPI
 bool vasilev_s_striped_horizontal_scheme_mpi::StripedHorizontalSchemeParallelMPI::run() {
   internal_order_test();
 
-  boost::mpi::broadcast(world, num_cols_, 0);
-  boost::mpi::broadcast(world, input_vector_, 0);
-  boost::mpi::broadcast(world, distribution, 0);
+  ppc::core::mpi::broadcast_value(world, num_cols_, 0);
+  // One copy of the vector per node, read in place by its processes
+  shared_vector_.assign(world, input_vector_, 0);
+  auto input_vector = shared_vector_.view();
+  ppc::core::mpi::broadcast_buffer(world, distribution, 0);
 
   int local_num_elements = distribution[world.rank()];
   int local_num_rows = local_num_elements / num_cols_;
 
-  std::vector<int> local_matrix(local_num_elements);
+  // Rows of the process are spread over its threads in the hybrid mode, pages
+  // of the rows are placed by the threads reading them
+  auto row_grain = std::max<size_t>(1, ppc::core::kMinReduceGrain / static_cast<size_t>(std::max(num_cols_, 1)));
+  if (local_matrix_.size() != static_cast<size_t>(local_num_elements)) {
+    local_matrix_ =
+        ppc::core::make_numa_vector<ppc::core::mpi::kRankBackend>(local_num_elements, 0, row_grain * num_cols_);
+  }
 
   if (world.rank() == 0) {
-    boost::mpi::scatterv(world, input_matrix_.data(), distribution, displacement, local_matrix.data(),
+    boost::mpi::scatterv(world, input_matrix_.data(), distribution, displacement, local_matrix_.data(),
                          local_num_elements, 0);
   } else {
-    boost::mpi::scatterv(world, local_matrix.data(), local_num_elements, 0);
-  }
-
-  std::vector<int> local_result(local_num_rows, 0);
-
-  for (int i = 0; i < local_num_rows; ++i) {
-    for (int j = 0; j < num_cols_; ++j) {
-      local_result[i] += local_matrix[i * num_cols_ + j] * input_vector_[j];
-    }
+    boost::mpi::scatterv(world, local_matrix_.data(), local_num_elements, 0);
   }
 
-  std::vector<int> gather_counts;
-  std::vector<int> gather_displacements;
+  auto local_result = scratch<int>(local_num_rows);
+
+  ppc::core::parallel_for<ppc::core::mpi::kRankBackend>(
+      0, local_num_rows,
+      [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+          for (int j = 0; j < num_cols_; ++j) {
+            local_result[i] += local_matrix_[i * num_cols_ + j] * input_vector[j];
+          }
+        }
+      },
+      row_grain);
 
   if (world.rank() == 0) {
     gather_counts.resize(world.size());
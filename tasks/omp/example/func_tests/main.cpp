@@ -6,7 +6,7 @@
 #include "omp/example/include/ops_omp.hpp"
 
 TEST(Parallel_Operations_OpenMP, Test_Sum) {
-  std::vector<int> vec = nesterov_a_test_task_omp::getRandomVector(100);
+  auto vec = nesterov_a_test_task_omp::getRandomVector(100);
   // Create data
   std::vector<int> ref_res(1, 0);
 
@@ -45,7 +45,7 @@ TEST(Parallel_Operations_OpenMP, Test_Sum) {
 }
 
 TEST(Parallel_Operations_OpenMP, Test_Diff) {
-  std::vector<int> vec = nesterov_a_test_task_omp::getRandomVector(100);
+  auto vec = nesterov_a_test_task_omp::getRandomVector(100);
   // Create data
   std::vector<int> ref_res(1, 0);
 
@@ -83,7 +83,7 @@ TEST(Parallel_Operations_OpenMP, Test_Diff) {
 }
 
 TEST(Parallel_Operations_OpenMP, Test_Diff_2) {
-  std::vector<int> vec = nesterov_a_test_task_omp::getRandomVector(10);
+  auto vec = nesterov_a_test_task_omp::getRandomVector(10);
   // Create data
   std::vector<int> ref_res(1, 0);
 
@@ -121,7 +121,7 @@ TEST(Parallel_Operations_OpenMP, Test_Diff_2) {
 }
 
 TEST(Parallel_Operations_OpenMP, Test_Mult) {
-  std::vector<int> vec = nesterov_a_test_task_omp::getRandomVector(10);
+  auto vec = nesterov_a_test_task_omp::getRandomVector(10);
   // Create data
   std::vector<int> ref_res(1, 0);
 
@@ -159,7 +159,7 @@ TEST(Parallel_Operations_OpenMP, Test_Mult) {
 }
 
 TEST(Parallel_Operations_OpenMP, Test_Mult_2) {
-  std::vector<int> vec = nesterov_a_test_task_omp::getRandomVector(5);
+  auto vec = nesterov_a_test_task_omp::getRandomVector(5);
   // Create data
   std::vector<int> ref_res(1, 0);
 
@@ -1,14 +1,17 @@
 // Copyright 2023 Nesterov Alexander
 #pragma once
 
+#include <span>
 #include <string>
 #include <vector>
 
+#include "core/memory/include/numa_allocator.hpp"
 #include "core/task/include/task.hpp"
 
 namespace nesterov_a_test_task_omp {
 
-std::vector<int> getRandomVector(int sz);
+// Pages of the vector are placed by threads of the parallel task's reduction
+ppc::core::numa_vector<int> getRandomVector(int sz);
 
 class TestOMPTaskSequential : public ppc::core::Task {
  public:
@@ -20,7 +23,7 @@ class TestOMPTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -35,7 +38,7 @@ class TestOMPTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -3,6 +3,7 @@
 
 #include <omp.h>
 
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <random>
@@ -10,12 +11,14 @@
 #include <thread>
 #include <vector>
 
+#include "core/parallel/include/parallel_reduce.hpp"
+
 using namespace std::chrono_literals;
 
-std::vector<int> nesterov_a_test_task_omp::getRandomVector(int sz) {
+ppc::core::numa_vector<int> nesterov_a_test_task_omp::getRandomVector(int sz) {
   std::random_device dev;
   std::mt19937 gen(dev());
-  std::vector<int> vec(sz);
+  auto vec = ppc::core::make_numa_vector<ppc::core::Backend::OMP>(sz, 0);
   for (int i = 0; i < sz; i++) {
     vec[i] = gen() % 100 + 1;
   }
@@ -24,12 +27,8 @@ std::vector<int> nesterov_a_test_task_omp::getRandomVector(int sz) {
 
 bool nesterov_a_test_task_omp::TestOMPTaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input
+  input_ = taskData->input<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -61,12 +60,8 @@ bool nesterov_a_test_task_omp::TestOMPTaskSequential::post_processing() {
 
 bool nesterov_a_test_task_omp::TestOMPTaskParallel::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input
+  input_ = taskData->input<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -81,24 +76,13 @@ bool nesterov_a_test_task_omp::TestOMPTaskParallel::validation() {
 bool nesterov_a_test_task_omp::TestOMPTaskParallel::run() {
   internal_order_test();
   double start = omp_get_wtime();
-  auto temp_res = res;
   if (ops == "+") {
-#pragma omp parallel for reduction(+ : temp_res)
-    for (int i = 0; i < static_cast<int>(input_.size()); i++) {
-      temp_res += input_[i];
-    }
+    res += static_cast<int>(ppc::core::parallel_sum<ppc::core::Backend::OMP>(input_));
   } else if (ops == "-") {
-#pragma omp parallel for reduction(- : temp_res)
-    for (int i = 0; i < static_cast<int>(input_.size()); i++) {
-      temp_res -= input_[i];
-    }
+    res -= static_cast<int>(ppc::core::parallel_sum<ppc::core::Backend::OMP>(input_));
   } else if (ops == "*") {
-#pragma omp parallel for reduction(* : temp_res)
-    for (int i = 0; i < static_cast<int>(input_.size()); i++) {
-      temp_res *= input_[i];
-    }
+    res *= ppc::core::parallel_reduce<ppc::core::Backend::OMP>(input_, 1, std::multiplies<>());
   }
-  res = temp_res;
   double finish = omp_get_wtime();
   std::cout << "How measure time in OpenMP: " << finish - start << std::endl;
   return true;
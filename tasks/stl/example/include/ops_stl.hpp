@@ -2,6 +2,7 @@
 #ifndef TASKS_EXAMPLES_TEST_STD_OPS_STD_H_
 #define TASKS_EXAMPLES_TEST_STD_OPS_STD_H_
 
+#include <span>
 #include <string>
 #include <vector>
 
@@ -21,7 +22,7 @@ class TestSTLTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -36,7 +37,7 @@ class TestSTLTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -2,14 +2,17 @@
 #ifndef TASKS_EXAMPLES_TEST_TBB_OPS_TBB_H_
 #define TASKS_EXAMPLES_TEST_TBB_OPS_TBB_H_
 
+#include <span>
 #include <string>
 #include <vector>
 
+#include "core/memory/include/numa_allocator.hpp"
 #include "core/task/include/task.hpp"
 
 namespace nesterov_a_test_task_tbb {
 
-std::vector<int> getRandomVector(int sz);
+// Pages of the vector are placed by threads of the parallel task's reduction
+ppc::core::numa_vector<int> getRandomVector(int sz);
 
 class TestTBBTaskSequential : public ppc::core::Task {
  public:
@@ -21,7 +24,7 @@ class TestTBBTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -36,7 +39,7 @@ class TestTBBTaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  std::span<const int> input_;
   int res{};
   std::string ops;
 };
@@ -1,8 +1,6 @@
 // Copyright 2023 Nesterov Alexander
 #include "tbb/example/include/ops_tbb.hpp"
 
-#include <tbb/tbb.h>
-
 #include <functional>
 #include <numeric>
 #include <random>
@@ -10,12 +8,14 @@
 #include <thread>
 #include <vector>
 
+#include "core/parallel/include/parallel_reduce.hpp"
+
 using namespace std::chrono_literals;
 
-std::vector<int> nesterov_a_test_task_tbb::getRandomVector(int sz) {
+ppc::core::numa_vector<int> nesterov_a_test_task_tbb::getRandomVector(int sz) {
   std::random_device dev;
   std::mt19937 gen(dev());
-  std::vector<int> vec(sz);
+  auto vec = ppc::core::make_numa_vector<ppc::core::Backend::TBB>(sz, 0);
   for (int i = 0; i < sz; i++) {
     vec[i] = gen() % 20 + 1;
   }
@@ -24,12 +24,8 @@ std::vector<int> nesterov_a_test_task_tbb::getRandomVector(int sz) {
 
 bool nesterov_a_test_task_tbb::TestTBBTaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input
+  input_ = taskData->input<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -61,12 +57,8 @@ bool nesterov_a_test_task_tbb::TestTBBTaskSequential::post_processing() {
 
 bool nesterov_a_test_task_tbb::TestTBBTaskParallel::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // Init view of input
+  input_ = taskData->input<int>(0);
   // Init value for output
   res = 1;
   return true;
@@ -81,29 +73,11 @@ bool nesterov_a_test_task_tbb::TestTBBTaskParallel::validation() {
 bool nesterov_a_test_task_tbb::TestTBBTaskParallel::run() {
   internal_order_test();
   if (ops == "+") {
-    res += oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 0,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total += std::accumulate(r.begin(), r.end(), 0);
-          return running_total;
-        },
-        std::plus<>());
+    res += static_cast<int>(ppc::core::parallel_sum<ppc::core::Backend::TBB>(input_));
   } else if (ops == "-") {
-    res -= oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 0,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total += std::accumulate(r.begin(), r.end(), 0);
-          return running_total;
-        },
-        std::plus<>());
+    res -= static_cast<int>(ppc::core::parallel_sum<ppc::core::Backend::TBB>(input_));
   } else if (ops == "*") {
-    res *= oneapi::tbb::parallel_reduce(
-        oneapi::tbb::blocked_range<std::vector<int>::iterator>(input_.begin(), input_.end()), 1,
-        [](tbb::blocked_range<std::vector<int>::iterator> r, int running_total) {
-          running_total *= std::accumulate(r.begin(), r.end(), 1, std::multiplies<>());
-          return running_total;
-        },
-        std::multiplies<>());
+    res *= ppc::core::parallel_reduce<ppc::core::Backend::TBB>(input_, 1, std::multiplies<>());
   }
   return true;
 }